@@ -5,13 +5,14 @@ import ast
 import json
 import time
 import math
+import random
 
 
 def snake_case_to_CamelCase(word):
     return ''.join(x.capitalize() or '_' for x in word.split('_'))
 
 
-def generate_data(lattice_type, l, p, q, sweep_limit, sweep_schedule, timeout, cycles, trials, job_number, greedy, correlated, sweep_rate):
+def generate_data(lattice_type, l, p, q, sweep_limit, sweep_schedule, timeout, cycles, trials, job_number, greedy, correlated, sweep_rate, threads=1, syndrome_weights=False):
     cwd = os.getcwd()
     build_directory = '{0}/{1}'.format(cwd, 'build')
 
@@ -21,16 +22,22 @@ def generate_data(lattice_type, l, p, q, sweep_limit, sweep_schedule, timeout, c
     clear_syndromes = 0
 
     start_time = time.time()
-    for _ in range(trials):
-        result = subprocess.run(
-            ['./SweepDecoder', str(l), str(p), str(q), str(cycles), lattice_type, str(sweep_limit), sweep_schedule, str(timeout), str(greedy).lower(), str(correlated).lower(), str(sweep_rate)], stdout=subprocess.PIPE, check=True, cwd=build_directory)
-        # print(result.stdout.decode('utf-8'))
-        result_list = ast.literal_eval(result.stdout.decode('utf-8'))
-        # print(result_list)
+    # All trials run in one process, the first line of output is the aggregate
+    arguments = ['./SweepDecoder', str(l), str(p), str(q), str(cycles), lattice_type, str(sweep_limit), sweep_schedule, str(timeout), str(greedy).lower(), str(correlated).lower(), str(sweep_rate), str(trials), str(threads)]
+    if syndrome_weights:
+        # Seed, first trial, engine and geometry cache come before the flag
+        arguments += [str(random.getrandbits(64)), '0', 'scalar', '', 'true']
+    result = subprocess.run(
+        arguments, stdout=subprocess.PIPE, check=True, cwd=build_directory)
+    output_lines = result.stdout.decode('utf-8').splitlines()
+    # print(output_lines)
+    successes, clear_syndromes, _ = ast.literal_eval(output_lines[0])
+    for line in output_lines[1:]:
+        result_list = ast.literal_eval(line)
         results.append(
-            {'Success': result_list[0], 'Clear syndrome': result_list[1], 'Time (s)': result_list[2]})
-        successes += result_list[0]
-        clear_syndromes += result_list[1]
+            {'Success': result_list[0], 'Clear syndrome': result_list[1], 'Time (s)': result_list[2], 'Readout sweeps': result_list[3]})
+        if syndrome_weights:
+            results[-1]['Syndrome weights'] = list(result_list[4:])
     elapsed_time = round(time.time() - start_time, 2)
 
     data['Results'] = results
@@ -47,6 +54,8 @@ def generate_data(lattice_type, l, p, q, sweep_limit, sweep_schedule, timeout, c
     data['Greedy'] = greedy
     data['Correlated errors'] = correlated
     data['Sweep rate'] = sweep_rate
+    data['Threads'] = threads
+    data['Syndrome weights'] = syndrome_weights
 
     # if lattice_type == 'rhombic_toric':
     #     data['Sweep direction'] = sweep_direction
@@ -101,6 +110,10 @@ if __name__ == "__main__":
                         help='use a nearest-neighbour correlated error model (default : False)')
     parser.add_argument("--sweep_rate", type=int, default=1,
                         help="the number of sweeps per stabilizer measurement (default : 1)")
+    parser.add_argument("--threads", type=int, default=1,
+                        help="number of worker threads, 0 uses every hardware thread (default : 1)")
+    parser.add_argument("--syndrome_weights", action='store_true',
+                        help="record the syndrome weight after every sweep of each trial (default : False)")
     parser.add_argument("--job", type=int, default=-1,
                         help="job number (default: -1)")
 
@@ -124,6 +137,8 @@ if __name__ == "__main__":
     greedy = args.greedy
     correlated = args.correlated_errors
     sweep_rate = args.sweep_rate
+    threads = args.threads
+    syndrome_weights = args.syndrome_weights
 
     generate_data(lattice_type, l, p, q, sweep_limit, sweep_schedule,
-                  timeout, cycles, trials, job_number, greedy, correlated, sweep_rate)
+                  timeout, cycles, trials, job_number, greedy, correlated, sweep_rate, threads, syndrome_weights)
@@ -5,10 +5,52 @@
 #include <chrono>
 #include <string>
 #include <sstream>
+#include <fstream>
+
+// Runs every point of a parameter grid, SweepDecoder grid <file> [threads]
+// [seed] [geometry cache], and prints a CSV line for each point as it is done
+int runGridFile(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "No parameter grid file given." << std::endl;
+        return 1;
+    }
+    std::ifstream file(argv[2]);
+    if (!file)
+    {
+        std::cerr << "Could not open " << argv[2] << "." << std::endl;
+        return 1;
+    }
+    ParameterGrid grid(file);
+    int threads = argc > 3 ? std::atoi(argv[3]) : 1;
+    uint64_t seed = argc > 4 ? std::stoull(argv[4]) : randomSeed();
+    std::string geometryCache = argc > 5 ? argv[5] : "";
+
+    const auto &points = grid.getPoints();
+    std::cout << ParameterGrid::header() << ",successes,clean_syndromes,time" << std::endl;
+    runGrid(points, threads, seed, [&](const int i, const trialStatistics &statistics) {
+        double time = 0;
+        for (const auto &result : statistics.results)
+        {
+            time += result.time;
+        }
+        ParameterGrid::writePoint(std::cout, points[i]);
+        std::cout << "," << statistics.successes
+                  << "," << statistics.cleanSyndromes
+                  << "," << time // Decoding time of all the trials of the point
+                  << std::endl;
+    }, geometryCache);
+    return 0;
+}
 
 int main(int argc, char *argv[])
 {
-    if (argc < 11)
+    if (argc > 1 && std::string(argv[1]) == "grid")
+    {
+        return runGridFile(argc, argv);
+    }
+    if (argc < 12)
     {
         std::cout << "Fewer than eleven arguments" << std::endl;
         for (int i = 0; i < argc; ++i)
@@ -41,8 +83,48 @@ int main(int argc, char *argv[])
         std::cerr << "Incorrect argument provided (boolean)." << std::endl;
         return 1;
     }
-    std::vector<bool> succ;
     int sweepRate = std::atoi(argv[11]);
+    // Optional number of trials, all run in this process on one lattice
+    bool multipleTrials = argc > 12;
+    int trials = multipleTrials ? std::atoi(argv[12]) : 1;
+    if (trials < 1)
+    {
+        std::cerr << "Number of trials must be a positive integer." << std::endl;
+        return 1;
+    }
+    // Optional number of worker threads, zero uses every hardware thread
+    int threads = argc > 13 ? std::atoi(argv[13]) : 1;
+    // Optional seed and number of the first trial, a run with the same seed
+    // and trial numbers gives the same results for any number of threads
+    uint64_t seed = argc > 14 ? std::stoull(argv[14]) : randomSeed();
+    uint64_t firstTrial = argc > 15 ? std::stoull(argv[15]) : 0;
+    // Optional engine, "bitsliced" decodes 64 trials at once
+    std::string engine = argc > 16 ? argv[16] : "scalar";
+    if (!(engine == "scalar" || engine == "bitsliced"))
+    {
+        std::cerr << "Engine must be scalar or bitsliced." << std::endl;
+        return 1;
+    }
+    // Optional directory of saved geometries, read if a geometry is there
+    // and written otherwise, so later runs skip building the lattice
+    std::string geometryCache = argc > 17 ? argv[17] : "";
+    // Optional flag, true appends the syndrome weight after every sweep to
+    // the line of each trial
+    bool recordSyndromeWeights = false;
+    if (argc > 18)
+    {
+        std::stringstream ssw(argv[18]);
+        if (!(ssw >> std::boolalpha >> recordSyndromeWeights))
+        {
+            std::cerr << "Incorrect argument provided (boolean)." << std::endl;
+            return 1;
+        }
+        if (recordSyndromeWeights && engine == "bitsliced")
+        {
+            std::cerr << "Syndrome weights are only recorded by the scalar engine." << std::endl;
+            return 1;
+        }
+    }
 
     auto start = std::chrono::high_resolution_clock::now();
     // if (latticeType == "rhombic_toric")
@@ -50,22 +132,44 @@ int main(int argc, char *argv[])
     //     succ = runToric(l, rounds, p, q, sweepDir, timeout, greedy, correlatedErrors);
     // }
     // else if (latticeType == "rhombic_boundaries" || latticeType == "cubic_boundaries")
-    if (latticeType == "rhombic_boundaries" || latticeType == "cubic_boundaries" || latticeType == "rhombic_toric" || latticeType == "cubic_toric")
-    {
-        // succ = runBoundaries(l, rounds, p, q, sweepLimit, sweepSchedule, timeout, latticeType, greedy, correlatedErrors);
-        succ = oneRun(l, rounds, p, q, sweepLimit, sweepSchedule, timeout, latticeType, greedy, correlatedErrors, sweepRate);
-    }
-    else
+    if (!(latticeType == "rhombic_boundaries" || latticeType == "cubic_boundaries" || latticeType == "rhombic_toric" || latticeType == "cubic_toric"))
     {
         throw std::invalid_argument("Invalid lattice type.");
     }
+    // succ = runBoundaries(l, rounds, p, q, sweepLimit, sweepSchedule, timeout, latticeType, greedy, correlatedErrors);
+    trialStatistics statistics = engine == "bitsliced"
+                                     ? runBitSlicedTrials(l, rounds, p, q, sweepLimit, sweepSchedule, timeout, latticeType, greedy, correlatedErrors, sweepRate, trials, threads, seed, firstTrial, geometryCache)
+                                     : runTrials(l, rounds, p, q, sweepLimit, sweepSchedule, timeout, latticeType, greedy, correlatedErrors, sweepRate, trials, threads, seed, firstTrial, geometryCache, recordSyndromeWeights);
     auto finish = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> elapsed = finish - start;
 
-    std::cout << succ[0] << ", " // Decoding succeeded
-              << succ[1] << ", " // Clean syndrome
-              << elapsed.count() // "s" <<
+    if (!multipleTrials)
+    {
+        std::cout << statistics.successes << ", "      // Decoding succeeded
+                  << statistics.cleanSyndromes << ", " // Clean syndrome
+                  << elapsed.count()                   // "s" <<
+                  << std::endl;
+        return 0;
+    }
+
+    // First line is the aggregate, then one line per trial which also gives
+    // the number of readout sweeps and any syndrome weights
+    std::cout << statistics.successes << ", "      // Number of successes
+              << statistics.cleanSyndromes << ", " // Number of clean syndromes
+              << elapsed.count()                   // Total time including lattice construction
               << std::endl;
+    for (const auto &result : statistics.results)
+    {
+        std::cout << result.success << ", "
+                  << result.cleanSyndrome << ", "
+                  << result.time << ", "
+                  << result.readoutSweeps;
+        for (const int weight : result.syndromeWeights)
+        {
+            std::cout << ", " << weight;
+        }
+        std::cout << std::endl;
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef BIT_SET_H
+#define BIT_SET_H
+
+#include "bitVector.h"
+#include <set>
+
+// Set of integers in [0, n) stored as a BitVector.
+// Has the parts of the std::set<int> interface used by the codes, plus
+// toggle() (XOR) and parity() (masked popcount).
+class BitSet
+{
+private:
+  BitVector bits;
+
+public:
+  // Iterates over the elements of the set in increasing order
+  class const_iterator
+  {
+  private:
+    const BitVector *bits;
+    int index;
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const int *pointer;
+    typedef int reference;
+
+    const_iterator(const BitVector *bits, int index) : bits(bits), index(index) {}
+    int operator*() const { return index; }
+    const_iterator &operator++()
+    {
+      index = bits->next(index + 1);
+      return *this;
+    }
+    bool operator==(const const_iterator &other) const { return index == other.index; }
+    bool operator!=(const const_iterator &other) const { return index != other.index; }
+  };
+  typedef const_iterator iterator;
+
+  BitSet(const int length = 0) : bits(length) {}
+
+  void reset(const int length) { bits.reset(length); }
+  void clear() { bits.clear(); }
+  void toggle(const int i) { bits.toggle(i); }
+  void toggle(const BitVector &mask) { bits.toggle(mask); } // symmetric difference
+  void insert(const int i) { bits.set(i); }
+  void erase(const int i) { bits.unset(i); }
+  void erase(const const_iterator &it) { bits.unset(*it); }
+  bool contains(const int i) const { return bits[i]; }
+  const_iterator find(const int i) const { return contains(i) ? const_iterator(&bits, i) : end(); }
+  const_iterator begin() const { return const_iterator(&bits, bits.next(0)); }
+  const_iterator end() const { return const_iterator(&bits, bits.size()); }
+  int size() const { return bits.count(); } // number of elements
+  bool empty() const { return !bits.any(); }
+  int length() const { return bits.size(); }
+  int parity(const BitSet &mask) const { return bits.parity(mask.bits); }
+  const BitVector &getBits() const { return bits; }
+  std::set<int> toSet() const { return std::set<int>(begin(), end()); }
+  bool operator==(const BitSet &other) const { return bits == other.bits; }
+  bool operator!=(const BitSet &other) const { return bits != other.bits; }
+  template <typename Tables>
+  void transferTables(Tables &tables) { bits.transferTables(tables); }
+};
+
+#endif
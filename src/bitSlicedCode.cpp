@@ -0,0 +1,334 @@
+#include "bitSlicedCode.h"
+#include <algorithm>
+#include <stdexcept>
+
+BitSlicedCode::BitSlicedCode(std::shared_ptr<const CodeGeometry> codeGeometry, const double dataP, const double measP) : geometry(codeGeometry),
+                                                                                                                         lattice(codeGeometry->lattice.get()),
+                                                                                                                         p(dataP),
+                                                                                                                         q(measP)
+{
+    if (dataP < 0 || dataP > 1)
+    {
+        throw std::invalid_argument("Data error probability must be between zero and one (inclusive).");
+    }
+    if (measP < 0 || measP > 1)
+    {
+        throw std::invalid_argument("Measurement error probability must be between zero and one (inclusive).");
+    }
+    for (const auto &decision : geometry->sweepTable.decisions)
+    {
+        if (decision.options == 0)
+        {
+            throw std::invalid_argument("Bit-sliced decoding needs every decision of the sweep rule in the sweep table.");
+        }
+    }
+    error.assign(geometry->numberOfFaces, 0);
+    syndrome.assign(geometry->numberOfEdges, 0);
+    flipBits.assign(geometry->numberOfFaces, 0);
+
+    pcg_extras::seed_seq_from<std::random_device> seedSource;
+    rnEngine = pcg32(seedSource);
+}
+
+void BitSlicedCode::setSeed(const uint64_t seed, const uint64_t stream)
+{
+    rnEngine = pcg32(seed, stream);
+}
+
+void BitSlicedCode::reset()
+{
+    std::fill(error.begin(), error.end(), 0);
+    std::fill(syndrome.begin(), syndrome.end(), 0);
+    measErrors.clear();
+}
+
+void BitSlicedCode::toggleError(const int faceIndex, const uint64_t lanes)
+{
+    error[faceIndex] ^= lanes;
+    for (const int edgeIndex : geometry->faceToSyndromeEdges[faceIndex])
+    {
+        syndrome[edgeIndex] ^= lanes;
+    }
+}
+
+void BitSlicedCode::generateRandomBits(const int n, const double probability)
+{
+    randomBits.reset(numberOfLanes * n);
+    randomBits.setBernoulli(rnEngine, probability);
+}
+
+uint64_t BitSlicedCode::randomWord()
+{
+    const uint64_t high = rnEngine();
+    return (high << 32) | rnEngine();
+}
+
+void BitSlicedCode::splitLanes(const uint64_t lanes, const int options, uint64_t *parts)
+{
+    if (options == 2)
+    {
+        const uint64_t bits = randomWord();
+        parts[0] = lanes & ~bits;
+        parts[1] = lanes & bits;
+        return;
+    }
+    // Two random bits pick one of three options, lanes which get the fourth
+    // value draw again
+    parts[0] = parts[1] = parts[2] = 0;
+    for (uint64_t remaining = lanes; remaining != 0;)
+    {
+        const uint64_t bits0 = randomWord();
+        const uint64_t bits1 = randomWord();
+        parts[0] |= remaining & ~bits0 & ~bits1;
+        parts[1] |= remaining & bits0 & ~bits1;
+        parts[2] |= remaining & ~bits0 & bits1;
+        remaining &= bits0 & bits1;
+    }
+}
+
+void BitSlicedCode::generateDataError(bool correlated)
+{
+    if (!correlated)
+    {
+        const int n = geometry->numberOfFaces;
+        generateRandomBits(n, p);
+        auto &words = randomBits.getWords();
+        for (int i = 0; i < n; ++i)
+        {
+            if (words[i] != 0)
+            {
+                toggleError(i, words[i]);
+            }
+        }
+    }
+    else
+    {
+        auto &pairs = geometry->correlatedIndices;
+        const int n = pairs.size();
+        generateRandomBits(n, p);
+        auto &words = randomBits.getWords();
+        for (int i = 0; i < n; ++i)
+        {
+            if (words[i] == 0)
+            {
+                continue;
+            }
+            // IX, XI or XX, each with probability 1/3
+            uint64_t parts[3];
+            splitLanes(words[i], 3, parts);
+            toggleError(pairs[i].first, parts[1] | parts[2]);
+            toggleError(pairs[i].second, parts[0] | parts[2]);
+        }
+    }
+}
+
+void BitSlicedCode::generateMeasError()
+{
+    // Only the edges which are stabilizers are measured
+    auto &measuredEdges = geometry->syndromeIndexList;
+    const int n = measuredEdges.size();
+    generateRandomBits(n, q);
+    auto &words = randomBits.getWords();
+    for (int i = 0; i < n; ++i)
+    {
+        if (words[i] != 0)
+        {
+            const int edgeIndex = measuredEdges[i];
+            syndrome[edgeIndex] ^= words[i];
+            measErrors.push_back({edgeIndex, words[i]});
+        }
+    }
+}
+
+void BitSlicedCode::updateSyndrome()
+{
+    for (const auto &measError : measErrors)
+    {
+        syndrome[measError.first] ^= measError.second;
+    }
+    measErrors.clear();
+}
+
+void BitSlicedCode::calculateSyndrome()
+{
+    std::fill(syndrome.begin(), syndrome.end(), 0);
+    measErrors.clear();
+    for (int i = 0; i < geometry->numberOfFaces; ++i)
+    {
+        if (error[i] != 0)
+        {
+            for (const int edgeIndex : geometry->faceToSyndromeEdges[i])
+            {
+                syndrome[edgeIndex] ^= error[i];
+            }
+        }
+    }
+}
+
+void BitSlicedCode::flipOption(const int vertexIndex, const int begin, const uint64_t lanes)
+{
+    const SweepTable &table = geometry->sweepTable;
+    for (int i = begin + 1, imax = begin + 1 + table.slots[begin]; i < imax; ++i)
+    {
+        const int face = geometry->slotFace(vertexIndex, table.slots[i]);
+        if (face != -1)
+        {
+            flipBits[face] ^= lanes;
+            flippedFaces.push_back(face);
+        }
+    }
+}
+
+void BitSlicedCode::sweep(const SignedDirection &direction, bool greedy, const uint64_t sweptLanes)
+{
+    if (direction.direction == Direction::x || direction.direction == Direction::y || direction.direction == Direction::z)
+    {
+        throw std::invalid_argument("Invalid sweep direction.");
+    }
+    const SweepTable &table = geometry->sweepTable;
+    for (auto const vertexIndex : geometry->sweepIndices)
+    {
+        auto upEdges = lattice->getUpEdges(vertexIndex, direction);
+        const int numberOfUpEdges = upEdges.size();
+        uint64_t upSyndrome[4];
+        uint64_t anyUp = 0;
+        for (int i = 0; i < numberOfUpEdges; ++i)
+        {
+            upSyndrome[i] = syndrome[upEdges[i]];
+            anyUp |= upSyndrome[i];
+        }
+        anyUp &= sweptLanes;
+        if (anyUp == 0)
+        {
+            continue;
+        }
+        const int ruleClass = geometry->sweepClass(vertexIndex);
+        uint64_t active = anyUp;
+        if (!greedy)
+        {
+            // Extremal in the lanes where every unsatisfied edge is an up-edge
+            for (const int edgeIndex : lattice->getVertexToEdges()[vertexIndex])
+            {
+                if (std::find(upEdges.begin(), upEdges.end(), edgeIndex) == upEdges.end())
+                {
+                    active &= ~syndrome[edgeIndex];
+                }
+            }
+        }
+        for (int mask = 1; mask < (1 << numberOfUpEdges) && active != 0; ++mask)
+        {
+            // Lanes in which the syndrome on the up-edges is mask
+            uint64_t lanes = active;
+            for (int i = 0; i < numberOfUpEdges; ++i)
+            {
+                lanes &= ((mask >> i) & 1) ? upSyndrome[i] : ~upSyndrome[i];
+            }
+            if (lanes == 0)
+            {
+                continue;
+            }
+            active &= ~lanes;
+            auto &decision = table.classDecision(ruleClass, direction, mask);
+            if (decision.options == 1)
+            {
+                flipOption(vertexIndex, decision.begin, lanes);
+                continue;
+            }
+            uint64_t parts[3];
+            splitLanes(lanes, decision.options, parts);
+            for (int option = 0, begin = decision.begin; option < decision.options; ++option)
+            {
+                if (parts[option] != 0)
+                {
+                    flipOption(vertexIndex, begin, parts[option]);
+                }
+                begin += 1 + table.slots[begin];
+            }
+        }
+    }
+    // The flips of every vertex are applied together, as in Code::sweep
+    for (const int face : flippedFaces)
+    {
+        if (flipBits[face] != 0)
+        {
+            toggleError(face, flipBits[face]);
+            flipBits[face] = 0;
+        }
+    }
+    flippedFaces.clear();
+}
+
+uint64_t BitSlicedCode::unsatisfiedLanes() const
+{
+    uint64_t lanes = 0;
+    for (const uint64_t word : syndrome)
+    {
+        lanes |= word;
+    }
+    return lanes;
+}
+
+uint64_t BitSlicedCode::correctedLanes() const
+{
+    // An odd overlap with any logical means the correction failed
+    vvint logicals = {geometry->logicalZ1};
+    if (!geometry->boundaries)
+    {
+        logicals.push_back(geometry->logicalZ2);
+        logicals.push_back(geometry->logicalZ3);
+    }
+    uint64_t failed = 0;
+    for (const auto &logical : logicals)
+    {
+        uint64_t parity = 0;
+        for (const int faceIndex : logical)
+        {
+            parity ^= error[faceIndex];
+        }
+        failed |= parity;
+    }
+    return ~failed;
+}
+
+void BitSlicedCode::setError(const int lane, const std::set<int> &faces)
+{
+    const uint64_t bit = uint64_t(1) << lane;
+    for (auto &word : error)
+    {
+        word &= ~bit;
+    }
+    for (const int i : faces)
+    {
+        if (i < 0 || i >= geometry->numberOfFaces)
+        {
+            throw std::invalid_argument("Error index out of range.");
+        }
+        error[i] |= bit;
+    }
+}
+
+std::set<int> BitSlicedCode::getError(const int lane) const
+{
+    std::set<int> faces;
+    for (int i = 0; i < geometry->numberOfFaces; ++i)
+    {
+        if ((error[i] >> lane) & 1)
+        {
+            faces.insert(i);
+        }
+    }
+    return faces;
+}
+
+BitVector BitSlicedCode::getSyndrome(const int lane) const
+{
+    BitVector laneSyndrome(syndrome.size());
+    for (int i = 0, imax = syndrome.size(); i < imax; ++i)
+    {
+        if ((syndrome[i] >> lane) & 1)
+        {
+            laneSyndrome.set(i);
+        }
+    }
+    return laneSyndrome;
+}
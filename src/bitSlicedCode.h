@@ -0,0 +1,61 @@
+#ifndef BIT_SLICED_CODE_H
+#define BIT_SLICED_CODE_H
+
+#include "codeGeometry.h"
+#include <memory>
+#include <set>
+#include "pcg_random.hpp"
+
+// Decodes 64 independent trials at once on a shared geometry. Every face and
+// edge has one word, and bit i of each word belongs to trial (lane) i, so
+// error generation, syndromes and sweeps work on all the lanes together. The
+// sweep rule is read from the sweep table of the geometry, with the random
+// choices of the rule made separately in every lane.
+class BitSlicedCode
+{
+private:
+  std::shared_ptr<const CodeGeometry> geometry;
+  const Lattice *lattice; // geometry->lattice
+  const double p; // data error probability
+  const double q; // measurement error probability
+  pcg32 rnEngine;
+  std::vector<uint64_t> error; // one word per face
+  std::vector<uint64_t> syndrome; // one word per edge
+  std::vector<uint64_t> flipBits; // one word per face
+  vint flippedFaces; // faces with flip bits in some lane
+  std::vector<std::pair<int, uint64_t>> measErrors; // edge and lanes, undone by updateSyndrome
+  BitVector randomBits; // 64 bits (lanes) per location, drawn by generateRandomBits
+
+  void toggleError(const int faceIndex, const uint64_t lanes);
+  void generateRandomBits(const int n, const double probability);
+  uint64_t randomWord();
+  // Random split of lanes between options parts, each lane with equal probability
+  void splitLanes(const uint64_t lanes, const int options, uint64_t *parts);
+  // Flip the faces of the option of a decision starting at begin
+  void flipOption(const int vertexIndex, const int begin, const uint64_t lanes);
+
+public:
+  static const int numberOfLanes = 64;
+
+  BitSlicedCode(std::shared_ptr<const CodeGeometry> geometry, const double dataErrorProbability, const double measErrorProbability);
+
+  void setSeed(const uint64_t seed, const uint64_t stream);
+  void reset();
+  void generateDataError(bool correlated);
+  void generateMeasError();
+  // The syndrome follows every change to the error, as for Code, so this
+  // only undoes the measurement errors
+  void updateSyndrome();
+  void calculateSyndrome();
+  // Only the lanes set in sweptLanes are swept, the others are left as they are
+  void sweep(const SignedDirection &direction, bool greedy, const uint64_t sweptLanes = ~uint64_t(0));
+  uint64_t unsatisfiedLanes() const; // lanes with a nonzero syndrome
+  uint64_t correctedLanes() const; // lanes where the error is not a logical
+
+  // Test methods
+  void setError(const int lane, const std::set<int> &faces);
+  std::set<int> getError(const int lane) const;
+  BitVector getSyndrome(const int lane) const;
+};
+
+#endif
@@ -0,0 +1,95 @@
+#include "bitVector.h"
+#include <algorithm>
+
+BitVector::BitVector(const int length)
+{
+    reset(length);
+}
+
+BitVector::BitVector(const std::vector<int8_t> &values)
+{
+    reset(values.size());
+    for (int i = 0; i < n; ++i)
+    {
+        if (values[i])
+        {
+            set(i);
+        }
+    }
+}
+
+void BitVector::reset(const int length)
+{
+    n = length;
+    words.assign((length + 63) / 64, 0);
+}
+
+void BitVector::clear()
+{
+    std::fill(words.begin(), words.end(), 0);
+}
+
+void BitVector::toggle(const BitVector &mask)
+{
+    for (int w = 0, wmax = words.size(); w < wmax; ++w)
+    {
+        words[w] ^= mask.words[w];
+    }
+}
+
+void BitVector::intersect(const BitVector &mask)
+{
+    for (int w = 0, wmax = words.size(); w < wmax; ++w)
+    {
+        words[w] &= mask.words[w];
+    }
+}
+
+bool BitVector::any() const
+{
+    uint64_t combined = 0;
+    for (const uint64_t word : words)
+    {
+        combined |= word;
+    }
+    return combined != 0;
+}
+
+int BitVector::count() const
+{
+    int total = 0;
+    for (const uint64_t word : words)
+    {
+        total += __builtin_popcountll(word);
+    }
+    return total;
+}
+
+int BitVector::next(const int i) const
+{
+    if (i >= n)
+    {
+        return n;
+    }
+    int w = i >> 6;
+    uint64_t word = words[w] & (~uint64_t(0) << (i & 63));
+    while (word == 0)
+    {
+        if (++w == static_cast<int>(words.size()))
+        {
+            return n;
+        }
+        word = words[w];
+    }
+    return 64 * w + __builtin_ctzll(word);
+}
+
+int BitVector::parity(const BitVector &mask) const
+{
+    uint64_t overlap = 0;
+    for (int w = 0, wmax = words.size(); w < wmax; ++w)
+    {
+        overlap ^= words[w] & mask.words[w];
+    }
+    return __builtin_parityll(overlap);
+}
@@ -0,0 +1,151 @@
+#ifndef BIT_VECTOR_H
+#define BIT_VECTOR_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+// Fixed length vector of 0/1 values packed 64 to a word.
+// Reads like a std::vector<int8_t>, writes go through set() and toggle().
+class BitVector
+{
+private:
+  std::vector<uint64_t> words;
+  int n;
+
+public:
+  // Iterates over the values (0 or 1) of every position
+  class const_iterator
+  {
+  private:
+    const BitVector *bits;
+    int index;
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const int *pointer;
+    typedef int reference;
+
+    const_iterator(const BitVector *bits, int index) : bits(bits), index(index) {}
+    int operator*() const { return (*bits)[index]; }
+    const_iterator &operator++()
+    {
+      ++index;
+      return *this;
+    }
+    bool operator==(const const_iterator &other) const { return index == other.index; }
+    bool operator!=(const const_iterator &other) const { return index != other.index; }
+  };
+  typedef const_iterator iterator;
+
+  BitVector(const int length = 0);
+  BitVector(const std::vector<int8_t> &values);
+
+  void reset(const int length); // resize to length, all values zero
+  void clear();                 // all values zero, length unchanged
+  int operator[](const int i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+  // The count values from position i as the bits of an integer, count < 64
+  uint64_t bits(const int i, const int count) const
+  {
+    uint64_t value = words[i >> 6] >> (i & 63);
+    if ((i & 63) + count > 64)
+    {
+      value |= words[(i >> 6) + 1] << (64 - (i & 63));
+    }
+    return value & ((uint64_t(1) << count) - 1);
+  }
+  void set(const int i) { words[i >> 6] |= uint64_t(1) << (i & 63); }
+  void unset(const int i) { words[i >> 6] &= ~(uint64_t(1) << (i & 63)); }
+  void toggle(const int i) { words[i >> 6] ^= uint64_t(1) << (i & 63); }
+  void toggle(const BitVector &mask);    // XOR with mask, which must have the same length
+  void intersect(const BitVector &mask); // AND with mask, which must have the same length
+  // Set every value independently to one with probability threshold / 2^32,
+  // comparing one raw 32-bit output of generator against threshold per value
+  template <typename Generator>
+  void setRandom(Generator &generator, const uint64_t threshold);
+  // Below this probability setBernoulli places the ones by geometric skipping
+  static constexpr double sparseProbability = 0.08;
+  // Set every value independently to one with this probability. Small
+  // probabilities draw the gap to the next one from the geometric
+  // distribution, so that one draw is made per one, others use setRandom.
+  template <typename Generator>
+  void setBernoulli(Generator &generator, const double probability);
+  int size() const { return n; }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, n); }
+  bool any() const;
+  int count() const;
+  int next(const int i) const;          // first position >= i holding a one, or size() if there is none
+  int parity(const BitVector &mask) const; // parity of the number of ones shared with mask
+  const std::vector<uint64_t> &getWords() const { return words; }
+  bool operator==(const BitVector &other) const { return n == other.n && words == other.words; }
+  bool operator!=(const BitVector &other) const { return !(*this == other); }
+  // Passes the length and words to tables(value), see Lattice::transferTables
+  template <typename Tables>
+  void transferTables(Tables &tables)
+  {
+    tables(n);
+    tables(words);
+  }
+};
+
+template <typename Generator>
+void BitVector::setRandom(Generator &generator, const uint64_t threshold)
+{
+  static_assert(Generator::min() == 0 && Generator::max() == std::numeric_limits<uint32_t>::max(),
+                "setRandom needs a generator of 32-bit outputs");
+  // Draws are made a word at a time and then compared, so the comparisons
+  // have no branches and can be vectorised
+  uint32_t draws[64];
+  for (int w = 0, wmax = words.size(); w < wmax; ++w)
+  {
+    const int bits = std::min(64, n - 64 * w);
+    for (int b = 0; b < bits; ++b)
+    {
+      draws[b] = generator();
+    }
+    uint64_t word = 0;
+    for (int b = 0; b < bits; ++b)
+    {
+      word |= uint64_t(draws[b] < threshold) << b;
+    }
+    words[w] = word;
+  }
+}
+
+template <typename Generator>
+void BitVector::setBernoulli(Generator &generator, const double probability)
+{
+  if (probability >= sparseProbability)
+  {
+    setRandom(generator, std::llround(std::ldexp(probability, 32)));
+    return;
+  }
+  clear();
+  const double logNoOne = std::log1p(-probability);
+  if (logNoOne == 0)
+  {
+    return;
+  }
+  std::uniform_real_distribution<double> distDouble0To1(0, std::nextafter(1, 2));
+  for (int i = -1;;)
+  {
+    // P(gap >= k) = (1 - p)^k
+    const double gap = std::log1p(-distDouble0To1(generator)) / logNoOne;
+    if (!(gap < n - i - 1))
+    {
+      return;
+    }
+    i += 1 + static_cast<int>(gap);
+    set(i);
+  }
+}
+
+#endif
@@ -6,11 +6,16 @@
 #include <random>
 #include <algorithm>
 #include <set>
+#include <map>
+#include <cmath>
+#include <cstring>
 
-Code::Code(const int ll, const double dataP, const double measP, bool boundaries, const int sweepRate) : l(ll),
+Code::Code(std::shared_ptr<const CodeGeometry> codeGeometry, const double dataP, const double measP, const int sweepRate) : geometry(codeGeometry),
+                                                                   lattice(codeGeometry->lattice.get()),
+                                                                   l(codeGeometry->l),
+                                                                   boundaries(codeGeometry->boundaries),
                                                                    p(dataP),
                                                                    q(measP),
-                                                                   boundaries(boundaries),
                                                                    sweepRate(sweepRate)
 {
     if (dataP < 0 || dataP > 1)
@@ -21,6 +26,10 @@ Code::Code(const int ll, const double dataP, const double measP, bool boundaries
     {
         throw std::invalid_argument("Measurement error probability must be between zero and one (inclusive).");
     }
+    syndrome.reset(geometry->numberOfEdges);
+    flipBits.reset(geometry->numberOfFaces);
+    error.reset(geometry->numberOfFaces);
+
     pcg_extras::seed_seq_from<std::random_device> seedSource;
     rnEngine = pcg32(seedSource);
     // rnEngine = pcg32(0); // Manual seed
@@ -31,26 +40,40 @@ Code::Code(const int ll, const double dataP, const double measP, bool boundaries
     distInt0To1 = std::uniform_int_distribution<int>(0, 1);
 }
 
+Code::Code(const Code &other) : geometry(other.geometry),
+                                lattice(other.lattice),
+                                l(other.l),
+                                boundaries(other.boundaries),
+                                syndrome(other.syndrome),
+                                flipBits(other.flipBits),
+                                error(other.error),
+                                p(other.p),
+                                q(other.q),
+                                sweepRate(other.sweepRate),
+                                distDouble0To1(other.distDouble0To1),
+                                distInt0To2(other.distInt0To2),
+                                distInt0To1(other.distInt0To1)
+{
+    // Copying the generator would give every clone the same random numbers
+    pcg_extras::seed_seq_from<std::random_device> seedSource;
+    rnEngine = pcg32(seedSource);
+}
+
+void Code::setSeed(const uint64_t seed, const uint64_t stream)
+{
+    rnEngine = pcg32(seed, stream);
+}
+
 void Code::buildCorrelatedIndices()
 {
-    // correlatedIndices = {};
-    correlatedIndices.reserve(numberOfFaces);
-    for (int i = 0; i < numberOfFaces; ++i)
+    if (!geometry->correlatedIndices.empty())
     {
-        for (int j = i + 1; j < numberOfFaces; ++j)
-        {
-            for (auto &ei : faceToEdges[i])
-            {
-                for (auto &ej : faceToEdges[j])
-                {
-                    if (ei == ej)
-                    {
-                        correlatedIndices.push_back({i, j});
-                    }
-                }
-            }
-        }
+        return;
     }
+    // The geometry may be shared so the pairs are added to a copy of it
+    auto correlatedGeometry = std::make_shared<CodeGeometry>(*geometry);
+    correlatedGeometry->buildCorrelatedIndices();
+    geometry = correlatedGeometry;
 }
 
 void Code::generateDataError(bool correlated)
@@ -58,95 +81,89 @@ void Code::generateDataError(bool correlated)
     // error.clear();
     if (!correlated)
     {
-        for (int i = 0; i < numberOfFaces; ++i)
+        const int n = geometry->numberOfFaces;
+        generateRandomBits(n, p);
+        for (int i = randomBits.next(0); i < n; i = randomBits.next(i + 1))
         {
-            // if (distDouble0To1(mt) <= p)
-            if (distDouble0To1(rnEngine) <= p)
-            {
-                auto it = error.find(i);
-                if (it == error.end())
-                {
-                    error.insert(i);
-                }
-                else
-                {
-                    error.erase(it);
-                }
-            }
+            toggleError(i);
         }
     }
     else
     {
-        vstr twoQubitErrors = {"ix", "xi", "xx"};
-        for (auto &pair : correlatedIndices)
+        auto &pairs = geometry->correlatedIndices;
+        const int n = pairs.size();
+        generateRandomBits(n, p);
+        for (int i = randomBits.next(0); i < n; i = randomBits.next(i + 1))
         {
-            if (distDouble0To1(rnEngine) <= p)
+            // IX, XI or XX, each with probability 1/3
+            const int twoQubitError = distInt0To2(rnEngine);
+            if (twoQubitError != 0)
             {
-                std::shuffle(twoQubitErrors.begin(), twoQubitErrors.end(), rnEngine);
-                if (twoQubitErrors[0].at(0) == 'x')
-                {
-                    // std::cerr << "X on q_i" << std::endl;
-                    auto it = error.find(pair[0]);
-                    if (it == error.end())
-                    {
-                        error.insert(pair[0]);
-                    }
-                    else
-                    {
-                        error.erase(it);
-                    }
-                }
-                if (twoQubitErrors[0].at(1) == 'x')
-                {
-                    // std::cerr << "X on q_j" << std::endl;
-                    auto it = error.find(pair[1]);
-                    if (it == error.end())
-                    {
-                        error.insert(pair[1]);
-                    }
-                    else
-                    {
-                        error.erase(it);
-                    }
-                }
+                toggleError(pairs[i].first);
+            }
+            if (twoQubitError != 1)
+            {
+                toggleError(pairs[i].second);
             }
         }
     }
 }
 
+void Code::generateRandomBits(const int n, const double probability)
+{
+    randomBits.reset(n);
+    randomBits.setBernoulli(rnEngine, probability);
+}
+
 void Code::setError(const std::set<int> &err)
 {
     error.clear();
     for (const int i : err)
     {
+        if (i < 0 || i >= error.length())
+        {
+            throw std::invalid_argument("Error index out of range.");
+        }
         error.insert(i);
     }
 }
 
-void Code::setSyndrome(std::vector<int8_t> &synd)
+void Code::setSyndrome(const std::vector<int8_t> &synd)
 {
-    syndrome = synd;
+    if (static_cast<int>(synd.size()) != geometry->numberOfEdges)
+    {
+        throw std::invalid_argument("Syndrome must have one entry per edge.");
+    }
+    syndrome = BitVector(synd);
+    measErrorEdges.clear();
+    unsatisfiedCount = syndrome.count();
+    activeStale = true;
 }
 
-std::vector<int8_t> &Code::getSyndrome()
+const BitVector &Code::getSyndrome()
 {
     return syndrome;
 }
 
-Lattice &Code::getLattice()
+const Lattice &Code::getLattice()
 {
     return *lattice;
 }
 
-std::set<int> &Code::getError()
+BitSet &Code::getError()
 {
     return error;
 }
 
 bool Code::checkExtremalVertex(const int vertexIndex, const std::string &direction)
 {
-    auto &upEdges = upEdgesMap[direction][vertexIndex];
-    auto &edges = vertexToEdges[vertexIndex];
+    return checkExtremalVertex(vertexIndex, toSignedDirection(direction));
+}
+
+bool Code::checkExtremalVertex(const int vertexIndex, const SignedDirection &direction)
+{
+    auto upEdges = lattice->getUpEdges(vertexIndex, direction);
+    auto edges = lattice->getVertexToEdges()[vertexIndex];
     bool edgeInSyndrome = false;
     for (const int edgeIndex : edges)
     {
@@ -167,7 +184,7 @@ void Code::localFlip(vint &vertices)
 {
     // std::cout << "Attempting local flip ... ";
     int faceIndex = lattice->findFace(vertices);
-    flipBits[faceIndex] = (flipBits[faceIndex] + 1) % 2;
+    flipBits.toggle(faceIndex);
     // std::cout << "flipped." << std::endl;
 }
 
@@ -177,45 +194,562 @@ vint Code::faceVertices(const int vertexIndex, vstr directions)
     {
         throw std::invalid_argument("Number of directions not equal to three.");
     }
-    vint signs;
-    signs.reserve(3);
-    for (int i = 0; i < 3; ++i)
+    return faceVertices(vertexIndex, {toSignedDirection(directions[0]),
+                                      toSignedDirection(directions[1]),
+                                      toSignedDirection(directions[2])});
+}
+
+vint Code::faceVertices(const int vertexIndex, const std::array<SignedDirection, 3> &directions)
+{
+    if (directions[1] != directions[2])
+    {
+        throw std::invalid_argument("Second and third directions (& signs) must be the same otherwise the vertices do not form a face.");
+    }
+    int neighbourVertex = lattice->neighbour(vertexIndex, directions[0].direction, directions[0].sign);
+    vint vertices = {vertexIndex, neighbourVertex,
+                     lattice->neighbour(vertexIndex, directions[1].direction, directions[1].sign),
+                     lattice->neighbour(neighbourVertex, directions[2].direction, directions[2].sign)};
+    std::sort(vertices.begin(), vertices.end());
+    return vertices;
+}
+
+int Code::randomChoice(const int options)
+{
+    if (recording)
+    {
+        recordedOptions.push_back(options);
+        return recordedChoice;
+    }
+    if (options == 2)
+    {
+        return distInt0To1(rnEngine);
+    }
+    return distInt0To2(rnEngine);
+}
+
+void Code::flipFace(const int vertexIndex, const std::array<SignedDirection, 3> &directions)
+{
+    if (recording)
+    {
+        if (directions[1] != directions[2])
+        {
+            throw std::invalid_argument("Second and third directions (& signs) must be the same otherwise the vertices do not form a face.");
+        }
+        recordedFlips.push_back(14 * directions[0].index() + directions[1].index());
+        return;
+    }
+    int face = faceIndex(vertexIndex, directions);
+    if (face != -1)
+    {
+        flipBits.toggle(face);
+    }
+}
+
+int Code::faceIndex(const int vertexIndex, const std::array<SignedDirection, 3> &directions)
+{
+    int neighbourVertex = lattice->findNeighbour(vertexIndex, directions[0]);
+    if (neighbourVertex == -1)
+    {
+        return -1;
+    }
+    std::array<int, 4> vertices = {vertexIndex, neighbourVertex,
+                                   lattice->findNeighbour(vertexIndex, directions[1]),
+                                   lattice->findNeighbour(neighbourVertex, directions[2])};
+    if (vertices[2] == -1 || vertices[3] == -1)
+    {
+        return -1;
+    }
+    return lattice->lookupFace(vertices);
+}
+
+void Code::sweep(const SignedDirection &direction, bool greedy)
+{
+    clearFlipBits();
+    if (unsatisfiedCount == 0)
+    {
+        return;
+    }
+    const vdir edgeDirections = sweepEdgeDirections(direction);
+    if (greedy)
+    {
+        sweepVertices<true>(direction, edgeDirections);
+    }
+    else
+    {
+        sweepVertices<false>(direction, edgeDirections);
+    }
+    applyFlipBits();
+}
+
+template <bool greedy>
+void Code::sweepVertices(const SignedDirection &direction, const vdir &edgeDirections)
+{
+    // The rule does nothing at a vertex without unsatisfied edges, so when
+    // there are few of them only the vertices on those edges are visited
+    if (activeSweepFactor * unsatisfiedCount < static_cast<int>(geometry->sweepIndices.size()))
+    {
+        findActiveVertices();
+        for (const int vertexIndex : activeList)
+        {
+            sweepFromTable<greedy>(vertexIndex, direction, edgeDirections);
+        }
+    }
+    else if (!geometry->sweepStencil.empty())
+    {
+        stencilSweep<greedy>(direction, edgeDirections);
+    }
+    else
+    {
+        for (auto const vertexIndex : geometry->sweepIndices)
+        {
+            sweepFromTable<greedy>(vertexIndex, direction, edgeDirections);
+        }
+    }
+}
+
+template <bool greedy>
+void Code::stencilSweep(const SignedDirection &direction, const vdir &edgeDirections)
+{
+    const SweepStencil &stencil = geometry->sweepStencil;
+    const SweepTable &table = geometry->sweepTable;
+    const int numberOfTypes = stencil.typeClass.size();
+    const int d = direction.index();
+    // The syndrome of the edges owned by each site of the w = 0 sub-lattice,
+    // bit k for edge slot k, as an (l + 2)^3 array with a halo of one site so
+    // that every offset of the stencil is a fixed shift along a contiguous row
+    const int n = l + 2;
+    siteSyndromes.resize(n * n * n);
+    for (int z = 0; z < l; ++z)
+    {
+        for (int y = 0; y < l; ++y)
+        {
+            uint8_t *row = &siteSyndromes[n * (y + 1 + n * (z + 1))];
+            const int rowSite = l * (y + l * z);
+            for (int x = 0; x < l; ++x)
+            {
+                // Sites without a vertex get the edges of the vertex they
+                // share an index with, which no offset ever reads
+                row[x + 1] = syndrome.bits(stencil.edgesPerOwner * ((rowSite + x) >> stencil.siteShift), stencil.edgesPerOwner);
+            }
+            row[0] = row[l];
+            row[l + 1] = row[1];
+        }
+        uint8_t *layer = &siteSyndromes[n * n * (z + 1)];
+        std::memcpy(layer, layer + n * l, n);
+        std::memcpy(layer + n * (l + 1), layer + n, n);
+    }
+    std::memcpy(&siteSyndromes[0], &siteSyndromes[n * n * l], n * n);
+    std::memcpy(&siteSyndromes[n * n * (l + 1)], &siteSyndromes[n * n], n * n);
+    auto offsetRow = [&](const SweepStencil::Offset &offset, const int y, const int z) {
+        return &siteSyndromes[n * (y + 1 + offset.y + n * (z + 1 + offset.z)) + 1 + offset.x];
+    };
+    rowMasks.resize(l);
+    for (int w = 0; 2 * w < numberOfTypes; ++w)
+    {
+        for (int z = 0; z < l; ++z)
+        {
+            for (int y = 0; y < l; ++y)
+            {
+                // Masks of the whole row first, one vertex type and up-edge at a time
+                std::fill(rowMasks.begin(), rowMasks.end(), 0);
+                int rowMask = 0;
+                for (int parity = 0; parity < 2; ++parity)
+                {
+                    auto upEdges = stencil.upEdges[14 * (2 * w + parity) + d];
+                    for (int i = 0; i < upEdges.size(); ++i)
+                    {
+                        const uint8_t *row = offsetRow(upEdges[i], y, z);
+                        const int k = upEdges[i].k;
+                        for (int x = (parity + y + z) & 1; x < l; x += 2)
+                        {
+                            const int bit = (row[x] >> k) & 1;
+                            rowMasks[x] |= bit << i;
+                            rowMask |= bit;
+                        }
+                    }
+                }
+                if (rowMask == 0)
+                {
+                    continue;
+                }
+                // Then the rule at every vertex of the row in order, as the
+                // random choices are made in the order of sweepIndices
+                for (int x = 0; x < l; ++x)
+                {
+                    const int mask = rowMasks[x];
+                    if (mask == 0)
+                    {
+                        continue;
+                    }
+                    const cartesian4 coordinate = {x, y, z, w};
+                    const int type = SweepStencil::type(coordinate);
+                    if (!greedy)
+                    {
+                        // Extremal unless an edge which is not an up-edge is unsatisfied
+                        bool extremal = true;
+                        for (const auto &offset : stencil.otherEdges[14 * type + d])
+                        {
+                            if ((offsetRow(offset, y, z)[x] >> offset.k) & 1)
+                            {
+                                extremal = false;
+                                break;
+                            }
+                        }
+                        if (!extremal)
+                        {
+                            continue;
+                        }
+                    }
+                    auto &decision = table.classDecision(stencil.typeClass[type], direction, mask);
+                    if (decision.options == 0)
+                    {
+                        sweepVertex(lattice->coordinateToIndex(coordinate), direction, edgeDirections);
+                        continue;
+                    }
+                    int begin = decision.begin;
+                    if (decision.options > 1)
+                    {
+                        for (int option = randomChoice(decision.options); option > 0; --option)
+                        {
+                            begin += 1 + table.slots[begin];
+                        }
+                    }
+                    auto faces = stencil.faces[type];
+                    for (int i = begin + 1, imax = begin + 1 + table.slots[begin]; i < imax; ++i)
+                    {
+                        flipBits.toggle(stencil.face(coordinate, faces[table.slots[i]]));
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <bool greedy>
+void Code::sweepFromTable(const int vertexIndex, const SignedDirection &direction, const vdir &edgeDirections)
+{
+    auto upEdges = lattice->getUpEdges(vertexIndex, direction);
+    int mask = 0;
+    for (int i = 0, imax = upEdges.size(); i < imax; ++i)
+    {
+        mask |= syndrome[upEdges[i]] << i;
+    }
+    // A vertex without unsatisfied up-edges is never extremal, so the cheaper
+    // test goes first
+    if (mask == 0)
+    {
+        return;
+    }
+    if (!greedy && !checkExtremalVertex(vertexIndex, direction))
+    {
+        return;
+    }
+    const SweepTable &table = geometry->sweepTable;
+    auto &decision = table.classDecision(geometry->sweepClass(vertexIndex), direction, mask);
+    if (decision.options == 0)
+    {
+        sweepVertex(vertexIndex, direction, edgeDirections);
+        return;
+    }
+    int begin = decision.begin;
+    if (decision.options > 1)
     {
-        if (directions[i].at(0) == '-')
+        // Skip the options before the chosen one
+        for (int option = randomChoice(decision.options); option > 0; --option)
         {
-            signs.push_back(-1);
-            directions[i] = directions[i].substr(1, directions[i].size() - 1);
+            begin += 1 + table.slots[begin];
+        }
+    }
+    for (int i = begin + 1, imax = begin + 1 + table.slots[begin]; i < imax; ++i)
+    {
+        const int face = geometry->slotFace(vertexIndex, table.slots[i]);
+        if (face != -1)
+        {
+            flipBits.toggle(face);
+        }
+    }
+}
+
+void Code::addActiveEdge(const int edgeIndex)
+{
+    auto &owner = lattice->getEdgeOwner(edgeIndex);
+    const int vertices[2] = {owner.vertex, lattice->findNeighbour(owner.vertex, owner.direction)};
+    for (const int vertexIndex : vertices)
+    {
+        if (vertexIndex != -1 && activeVertices[vertexIndex] == 0)
+        {
+            // Vertices which are never swept stay flagged but out of the list,
+            // so they are not looked at again
+            activeVertices.set(vertexIndex);
+            if (geometry->sweepClass(vertexIndex) != -1)
+            {
+                activeList.push_back(vertexIndex);
+            }
+        }
+    }
+}
+
+void Code::findActiveVertices()
+{
+    // activeList is sorted from the last call, the vertices added since are
+    // sorted on their own and merged in
+    int sorted = activeList.size();
+    if (activeStale)
+    {
+        activeVertices.reset(lattice->getNumberOfVertices());
+        activeList.clear();
+        sorted = 0;
+        for (int edgeIndex = syndrome.next(0), imax = syndrome.size(); edgeIndex < imax; edgeIndex = syndrome.next(edgeIndex + 1))
+        {
+            addActiveEdge(edgeIndex);
+        }
+        activeStale = false;
+    }
+    else
+    {
+        for (const int edgeIndex : newlyUnsatisfied)
+        {
+            if (syndrome[edgeIndex] == 1)
+            {
+                addActiveEdge(edgeIndex);
+            }
+        }
+    }
+    newlyUnsatisfied.clear();
+    std::sort(activeList.begin() + sorted, activeList.end());
+    std::inplace_merge(activeList.begin(), activeList.begin() + sorted, activeList.end());
+    auto &vertexToEdges = lattice->getVertexToEdges();
+    auto kept = activeList.begin();
+    for (const int vertexIndex : activeList)
+    {
+        bool unsatisfied = false;
+        for (const int edgeIndex : vertexToEdges[vertexIndex])
+        {
+            if (syndrome[edgeIndex] == 1)
+            {
+                unsatisfied = true;
+                break;
+            }
+        }
+        if (unsatisfied)
+        {
+            *kept++ = vertexIndex;
         }
         else
         {
-            signs.push_back(1);
+            activeVertices.unset(vertexIndex);
         }
     }
-    if (signs[1] != signs[2] || directions[1] != directions[2])
+    activeList.erase(kept, activeList.end());
+}
+
+void Code::applyFlipBits()
+{
+    for (int i = flipBits.next(0), imax = flipBits.size(); i < imax; i = flipBits.next(i + 1))
+    {
+        toggleError(i);
+    }
+}
+
+void Code::toggleError(const int faceIndex)
+{
+    error.toggle(faceIndex);
+    for (const int edgeIndex : geometry->faceToSyndromeEdges[faceIndex])
     {
-        throw std::invalid_argument("Second and third directions (& signs) must be the same otherwise the vertices do not form a face.");
+        toggleSyndrome(edgeIndex);
     }
-    int neighbourVertex = lattice->neighbour(vertexIndex, directions[0], signs[0]);
-    vint vertices = {vertexIndex, neighbourVertex,
-                     lattice->neighbour(vertexIndex, directions[1], signs[1]),
-                     lattice->neighbour(neighbourVertex, directions[2], signs[2])};
-    std::sort(vertices.begin(), vertices.end());
-    return vertices;
 }
 
-std::vector<int8_t> &Code::getFlipBits()
+void Code::toggleSyndrome(const int edgeIndex)
+{
+    syndrome.toggle(edgeIndex);
+    unsatisfiedCount += 2 * syndrome[edgeIndex] - 1;
+    if (syndrome[edgeIndex] == 1 && !activeStale)
+    {
+        newlyUnsatisfied.push_back(edgeIndex);
+        activeStale = newlyUnsatisfied.size() > geometry->sweepIndices.size();
+    }
+}
+
+SweepTable Code::buildSweepTable()
+{
+    const vdir sweepDirections = {Direction::xyz, Direction::xy, Direction::xz, Direction::yz,
+                                  -Direction::xyz, -Direction::xy, -Direction::xz, -Direction::yz};
+    std::vector<vdir> edgeDirections;
+    for (auto &direction : sweepDirections)
+    {
+        edgeDirections.push_back(sweepEdgeDirections(direction));
+    }
+    const int numberOfDecisions = 14 * SweepTable::numberOfMasks;
+    SweepTable table;
+    table.vertexClass.assign(lattice->getNumberOfVertices(), -1);
+    table.vertexFacesBegin.assign(lattice->getNumberOfVertices() + 1, 0);
+    std::map<vint, int> classes;
+    vvint classFlips; // direction pair code of each slot, by class
+    clearSyndrome();
+    recording = true;
+    for (auto const vertexIndex : geometry->sweepIndices)
+    {
+        // Decisions at this vertex, with slots numbered in order of first use
+        std::vector<SweepTable::Decision> decisions(numberOfDecisions, {1, 0});
+        std::vector<int8_t> slots = {0};
+        vint flips;
+        auto addOption = [&slots, &flips](const vint &faces) {
+            slots.push_back(faces.size());
+            for (const int face : faces)
+            {
+                auto it = std::find(flips.begin(), flips.end(), face);
+                slots.push_back(it - flips.begin());
+                if (it == flips.end())
+                {
+                    flips.push_back(face);
+                }
+            }
+        };
+        for (int d = 0, dmax = sweepDirections.size(); d < dmax; ++d)
+        {
+            auto &direction = sweepDirections[d];
+            auto upEdges = lattice->getUpEdges(vertexIndex, direction);
+            if ((1 << upEdges.size()) > SweepTable::numberOfMasks)
+            {
+                throw std::length_error("Too many up-edges for the sweep table.");
+            }
+            for (int mask = 1; mask < (1 << upEdges.size()); ++mask)
+            {
+                auto &decision = decisions[direction.index() * SweepTable::numberOfMasks + mask];
+                for (int i = 0; i < upEdges.size(); ++i)
+                {
+                    if ((mask >> i) & 1)
+                    {
+                        syndrome.set(upEdges[i]);
+                    }
+                }
+                const int begin = slots.size();
+                try
+                {
+                    // Run the rule once for each value of its random choice
+                    int options = 1;
+                    for (int choice = 0; choice < options; ++choice)
+                    {
+                        recordedChoice = choice;
+                        recordedOptions.clear();
+                        recordedFlips.clear();
+                        sweepVertex(vertexIndex, direction, edgeDirections[d]);
+                        if (recordedOptions.size() > 1 ||
+                            (choice > 0 && (recordedOptions.size() != 1 || recordedOptions[0] != options)))
+                        {
+                            throw std::length_error("Rule makes more than one random choice.");
+                        }
+                        if (choice == 0 && recordedOptions.size() == 1)
+                        {
+                            options = recordedOptions[0];
+                        }
+                        addOption(recordedFlips);
+                    }
+                    decision = {static_cast<int8_t>(options), begin};
+                }
+                catch (const std::exception &e)
+                {
+                    // Run the rule itself (and throw where it throws) during the sweep
+                    slots.resize(begin);
+                    decision = {0, 0};
+                }
+                for (const int edge : upEdges)
+                {
+                    syndrome.unset(edge);
+                }
+            }
+        }
+        // Vertices with the same decisions and slots share a class
+        vint key(slots.begin(), slots.end());
+        for (auto &decision : decisions)
+        {
+            key.push_back(decision.options);
+            key.push_back(decision.begin);
+        }
+        key.insert(key.end(), flips.begin(), flips.end());
+        auto it = classes.find(key);
+        if (it == classes.end())
+        {
+            it = classes.insert({key, classFlips.size()}).first;
+            const int offset = table.slots.size();
+            for (auto &decision : decisions)
+            {
+                table.decisions.push_back({decision.options, decision.begin + offset});
+            }
+            table.slots.insert(table.slots.end(), slots.begin(), slots.end());
+            classFlips.push_back(flips);
+        }
+        table.vertexClass[vertexIndex] = it->second;
+    }
+    recording = false;
+    recordedOptions.clear();
+    recordedFlips.clear();
+    // Face index of each slot of each vertex
+    for (int vertexIndex = 0, imax = table.vertexClass.size(); vertexIndex < imax; ++vertexIndex)
+    {
+        table.vertexFacesBegin[vertexIndex] = table.vertexFaces.size();
+        if (table.vertexClass[vertexIndex] == -1)
+        {
+            continue;
+        }
+        for (const int flip : classFlips[table.vertexClass[vertexIndex]])
+        {
+            SignedDirection first(static_cast<Direction>((flip / 14) % 7), flip / 14 < 7 ? 1 : -1);
+            SignedDirection second(static_cast<Direction>((flip % 14) % 7), flip % 14 < 7 ? 1 : -1);
+            table.vertexFaces.push_back(faceIndex(vertexIndex, {first, second, second}));
+        }
+    }
+    table.vertexFacesBegin.back() = table.vertexFaces.size();
+    return table;
+}
+
+void Code::sweep(const std::string &direction, bool greedy)
+{
+    SignedDirection sweepDirection;
+    try
+    {
+        sweepDirection = toSignedDirection(direction);
+    }
+    catch (const std::invalid_argument &e)
+    {
+        throw std::invalid_argument("Invalid sweep direction.");
+    }
+    sweep(sweepDirection, greedy);
+}
+
+vstr Code::findSweepEdges(const int vertexIndex, const std::string &direction)
+{
+    return toStrings(findSweepEdges(vertexIndex, toSignedDirection(direction)));
+}
+
+BitVector &Code::getFlipBits()
 {
     return flipBits;
 }
 
 void Code::clearSyndrome()
 {
-    syndrome.assign(numberOfEdges, 0);
+    syndrome.clear();
+    measErrorEdges.clear();
+    unsatisfiedCount = 0;
+    activeVertices.reset(lattice->getNumberOfVertices());
+    activeList.clear();
+    newlyUnsatisfied.clear();
+    activeStale = false;
 }
 
 void Code::clearFlipBits()
 {
-    flipBits.assign(numberOfFaces, 0);
+    flipBits.clear();
+}
+
+void Code::reset()
+{
+    // Clear the state of a trial, lattice tables are left untouched
+    error.clear();
+    clearSyndrome();
+    clearFlipBits();
 }
 
 void Code::printUnsatisfiedStabilisers()
@@ -224,7 +758,9 @@ void Code::printUnsatisfiedStabilisers()
     {
         if (syndrome[i] == 1)
         {
-            std::cerr << i << std::endl;
+            // Edge indices are compact, so also print where the edge is
+            auto &owner = lattice->getEdgeOwner(i);
+            std::cerr << i << " " << lattice->indexToCoordinate(owner.vertex) << " " << toString(owner.direction) << std::endl;
         }
     }
 }
@@ -232,7 +768,7 @@ void Code::printUnsatisfiedStabilisers()
 void Code::printError()
 {
     auto &faceToVertices = lattice->getFaceToVertices();
-    for (auto &face : error)
+    for (const int face : error)
     {
         vint vertices = faceToVertices[face];
         std::cerr << face << std::endl;
@@ -243,14 +779,19 @@ void Code::printError()
     }
 }
 
-std::set<int> &Code::getSyndromeIndices()
+const vint &Code::getSyndromeIndices()
 {
-    return syndromeIndices;
+    return geometry->syndromeIndexList;
 }
 
-vint &Code::getSweepIndices()
+const vint &Code::getSweepIndices()
 {
-    return sweepIndices;
+    return geometry->sweepIndices;
+}
+
+std::shared_ptr<const CodeGeometry> Code::getGeometry()
+{
+    return geometry;
 }
 
 vvint Code::getLogicals()
@@ -258,55 +799,27 @@ vvint Code::getLogicals()
     vvint logicals;
     if (boundaries)
     {
-        logicals.push_back(logicalZ1);
+        logicals.push_back(geometry->logicalZ1);
     }
     else
     {
-        logicals.push_back(logicalZ1);
-        logicals.push_back(logicalZ2);
-        logicals.push_back(logicalZ3);
+        logicals.push_back(geometry->logicalZ1);
+        logicals.push_back(geometry->logicalZ2);
+        logicals.push_back(geometry->logicalZ3);
     }
     return logicals;
 }
 
 bool Code::checkCorrection()
 {
-    int parityZ1 = 0, parityZ2 = 0, parityZ3 = 0;
-    for (int faceIndex : logicalZ1)
-    {
-        if (error.find(faceIndex) != error.end())
-        {
-            parityZ1 = (parityZ1 + 1) % 2;
-            // std::cout << faceIndex << std::endl;
-        }
-    }
-    if (parityZ1 % 2 == 1)
+    // An odd overlap with any logical means the correction failed
+    if (error.parity(geometry->logicalMaskZ1) == 1)
     {
         return false;
     }
     if (!boundaries)
     {
-        for (int faceIndex : logicalZ2)
-        {
-            if (error.find(faceIndex) != error.end())
-            {
-                parityZ2 = (parityZ2 + 1) % 2;
-                // std::cout << faceIndex << std::endl;
-            }
-        }
-        if (parityZ2 % 2 == 1)
-        {
-            return false;
-        }
-        for (int faceIndex : logicalZ3)
-        {
-            if (error.find(faceIndex) != error.end())
-            {
-                parityZ3 = (parityZ3 + 1) % 2;
-                // std::cout << faceIndex << std::endl;
-            }
-        }
-        if (parityZ3 % 2 == 1)
+        if (error.parity(geometry->logicalMaskZ2) == 1 || error.parity(geometry->logicalMaskZ3) == 1)
         {
             return false;
         }
@@ -317,39 +830,42 @@ bool Code::checkCorrection()
 void Code::calculateSyndrome()
 {
     clearSyndrome();
+    auto &faceToSyndromeEdges = geometry->faceToSyndromeEdges;
     for (const int errorIndex : error)
     {
-        auto &edges = faceToEdges[errorIndex];
-        for (const int edgeIndex : edges)
+        for (const int edgeIndex : faceToSyndromeEdges[errorIndex])
         {
-            if (boundaries)
-            {
-                auto it = syndromeIndices.find(edgeIndex);
-                if (it == syndromeIndices.end())
-                {
-                    continue;
-                }
-            }
-            syndrome[edgeIndex] = (syndrome[edgeIndex] + 1) % 2;
+            syndrome.toggle(edgeIndex);
         }
     }
+    unsatisfiedCount = syndrome.count();
+    activeStale = true;
+}
+
+void Code::updateSyndrome()
+{
+    for (const int edgeIndex : measErrorEdges)
+    {
+        toggleSyndrome(edgeIndex);
+    }
+    measErrorEdges.clear();
+}
+
+int Code::getUnsatisfiedCount()
+{
+    return unsatisfiedCount;
 }
 
 void Code::generateMeasError()
 {
-    for (int i = 0, imax = syndrome.size() ; i < imax; ++i)
+    // Only the edges which are stabilizers are measured
+    auto &measuredEdges = geometry->syndromeIndexList;
+    const int n = measuredEdges.size();
+    generateRandomBits(n, q);
+    for (int i = randomBits.next(0); i < n; i = randomBits.next(i + 1))
     {
-        if (boundaries)
-        {
-            auto it = syndromeIndices.find(i);
-            if (it == syndromeIndices.end())
-            {
-                continue;
-            }
-        }
-        if (distDouble0To1(rnEngine) <= q)
-        {
-            syndrome[i] = (syndrome[i] + 1) % 2;
-        }
+        const int edgeIndex = measuredEdges[i];
+        toggleSyndrome(edgeIndex);
+        measErrorEdges.push_back(edgeIndex);
     }
 }
\ No newline at end of file
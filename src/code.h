@@ -2,36 +2,32 @@
 #define CODE_H
 
 #include "lattice.h"
+#include "codeGeometry.h"
 #include <string>
 #include <set>
 #include <memory>
+#include <array>
 #include "pcg_random.hpp"
 #include <random>
 // #include "gtest/gtest_prod.h"
 
+// The state of one decoder (error, syndrome, flip bits and random number
+// generator) on a geometry which may be shared with other codes
 class Code
 {
 protected:
+  std::shared_ptr<const CodeGeometry> geometry;
+  const Lattice *lattice; // geometry->lattice
   const int l;
-  int numberOfFaces;
-  int numberOfEdges;
-  std::vector<int8_t> syndrome;
-  std::vector<int8_t> flipBits;
-  std::set<int> syndromeIndices;
-  std::unique_ptr<Lattice> lattice;
-  std::vector<int> sweepIndices;
-  std::map<std::string, vvint> upEdgesMap;
-  vvint faceToEdges;
-  vvint vertexToEdges;
-  std::set<int> error;
+  const bool boundaries;
+  BitVector syndrome; // one bit per edge
+  vint measErrorEdges; // syndrome bits flipped by measurement errors, undone by updateSyndrome
+  int unsatisfiedCount = 0; // number of ones in syndrome
+  BitVector flipBits; // one bit per face
+  BitSet error; // one bit per face
   const double p; // data error probability
   const double q; // measurement error probability
-  bool boundaries;
   const int sweepRate; // number of sweeps per stabilizer measurement 
-  vint logicalZ1;
-  vint logicalZ2;
-  vint logicalZ3;
-  vvint correlatedIndices;
 
   // pcg-random
   pcg32 rnEngine;
@@ -43,22 +39,84 @@ protected:
   std::uniform_int_distribution<int> distInt0To2;
   std::uniform_int_distribution<int> distInt0To1;
 
+  // Set while the sweep rule is recorded by buildSweepTable
+  bool recording = false;
+  int recordedChoice; // returned by randomChoice while recording
+  vint recordedOptions; // number of options of each random choice
+  vint recordedFlips; // faces flipped, as a direction pair code
+
+  // Random choice of the sweep rule between this many (2 or 3) options
+  int randomChoice(const int options);
+  // Flip the face given by faceVertices (if it is in the lattice), or record it
+  void flipFace(const int vertexIndex, const std::array<SignedDirection, 3> &directions);
+  void applyFlipBits();
+  // The sweep kernels are compiled for each sweep mode, which sweep picks once
+  template <bool greedy>
+  void sweepVertices(const SignedDirection &direction, const vdir &edgeDirections);
+  // Sweep rule at one vertex, from the sweep table where it has a decision
+  template <bool greedy>
+  void sweepFromTable(const int vertexIndex, const SignedDirection &direction, const vdir &edgeDirections);
+  // Sweeps visit only the vertices of activeList while there are fewer than one
+  // unsatisfied stabilizer for every activeSweepFactor sweep vertices
+  static constexpr int activeSweepFactor = 8;
+  // Vertices which may be on an unsatisfied edge, kept as the syndrome
+  // changes: toggleSyndrome records the edges which become unsatisfied,
+  // findActiveVertices adds both ends of each and drops the vertices left
+  // without one, so a sparse sweep costs in the number of changed edges, not
+  // the lattice. activeVertices flags the vertices which are in activeList.
+  BitVector activeVertices;
+  vint activeList;
+  vint newlyUnsatisfied; // edges recorded by toggleSyndrome since findActiveVertices
+  // Set when the syndrome was replaced wholesale or more edges changed than
+  // there are sweep vertices, activeList is then rebuilt from the syndrome
+  bool activeStale = true;
+  void addActiveEdge(const int edgeIndex);
+  // Leaves the sweep vertices on unsatisfied edges in activeList, in
+  // increasing order like sweepIndices so that random choices are made in
+  // the same order
+  void findActiveVertices();
+  // Sweep of every vertex of a toric code with the stencil of its geometry,
+  // a row of vertices at a time
+  template <bool greedy>
+  void stencilSweep(const SignedDirection &direction, const vdir &edgeDirections);
+  std::vector<uint8_t> siteSyndromes; // syndrome of the edges of each site with a halo, see stencilSweep
+  std::vector<uint8_t> rowMasks; // syndrome on the up-edges of each vertex of a row
+  // Toggle a face of the error and the syndrome bits of its stabilizers
+  void toggleError(const int faceIndex);
+  void toggleSyndrome(const int edgeIndex);
+  BitVector randomBits; // locations of errors drawn by generateRandomBits
+  // Set each of the first n bits of randomBits independently with probability
+  // probability, and resize it to n
+  void generateRandomBits(const int n, const double probability);
+
 public:
-  Code(const int latticeLength, const double dataErrorProbability, const double measErrorProbability, bool boundaries, const int sweepRate);
+  Code(std::shared_ptr<const CodeGeometry> geometry, const double dataErrorProbability, const double measErrorProbability, const int sweepRate);
+  // A copy shares the geometry of the original but gets its own random number generator
+  Code(const Code &other);
+  // Restart the random number generator on one stream of seed
+  void setSeed(const uint64_t seed, const uint64_t stream);
 
   void generateDataError(bool correlated);
+  bool checkExtremalVertex(const int vertexIndex, const SignedDirection &direction);
   bool checkExtremalVertex(const int vertexIndex, const std::string &direction);
   void localFlip(vint &vertices);
+  vint faceVertices(const int vertexIndex, const std::array<SignedDirection, 3> &directions);
   vint faceVertices(const int vertexIndex, vstr directions);
+  // Index of the face given by faceVertices, -1 if it isn't in the lattice
+  int faceIndex(const int vertexIndex, const std::array<SignedDirection, 3> &directions);
   void clearSyndrome();
   void clearFlipBits();
+  void reset();
   bool checkCorrection();
   void calculateSyndrome();
+  // The syndrome follows every change to the error made by the code, so
+  // this only undoes the measurement errors to give the syndrome of the error
+  void updateSyndrome();
   void generateMeasError();
   void buildCorrelatedIndices();
 
   // Test methods
-  void setSyndrome(std::vector<int8_t> &syndrome);
+  void setSyndrome(const std::vector<int8_t> &syndrome);
   void setError(const std::set<int> &error);
 
   // Debug methods
@@ -66,20 +124,29 @@ public:
   void printError();
 
   // Getter methods
-  std::vector<int8_t> &getFlipBits();
-  std::vector<int8_t> &getSyndrome();
-  Lattice &getLattice();
-  std::set<int> &getError();
-  std::set<int> &getSyndromeIndices();
-  vint &getSweepIndices();
+  BitVector &getFlipBits();
+  const BitVector &getSyndrome(); // changed only by the code, so that its count stays right
+  int getUnsatisfiedCount(); // number of ones in the syndrome
+  const Lattice &getLattice();
+  BitSet &getError();
+  const vint &getSyndromeIndices(); // in increasing order
+  const vint &getSweepIndices();
   vvint getLogicals();
+  // Record the sweep rule at every sweep vertex as a table for the geometry
+  SweepTable buildSweepTable();
+  std::shared_ptr<const CodeGeometry> getGeometry();
   
   // Virtual methods
-  virtual void buildSyndromeIndices() = 0;
-  virtual void buildSweepIndices() = 0;
-  virtual void sweep(const std::string &direction, bool greedy) = 0;
-  virtual vstr findSweepEdges(const int vertexIndex, const std::string &direction) = 0;
-  virtual void buildLogicals() = 0;
+  virtual vdir findSweepEdges(const int vertexIndex, const SignedDirection &direction) = 0;
+  // Up-edge directions used by the rule, throws for an invalid sweep direction
+  virtual vdir sweepEdgeDirections(const SignedDirection &direction) = 0;
+  // The sweep rule at one vertex
+  virtual void sweepVertex(const int vertexIndex, const SignedDirection &direction, const vdir &edgeDirections) = 0;
+  void sweep(const SignedDirection &direction, bool greedy);
+  void sweep(const std::string &direction, bool greedy);
+  vstr findSweepEdges(const int vertexIndex, const std::string &direction);
+  // New code with the same geometry and a fresh random number generator
+  virtual std::unique_ptr<Code> clone() const = 0;
   virtual ~Code() = default;
 
 };
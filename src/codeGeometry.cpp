@@ -0,0 +1,246 @@
+#include "codeGeometry.h"
+#include <algorithm>
+
+void CodeGeometry::buildLogicalMasks()
+{
+    const vvint logicals = {logicalZ1, logicalZ2, logicalZ3};
+    BitSet *masks[] = {&logicalMaskZ1, &logicalMaskZ2, &logicalMaskZ3};
+    for (int i = 0; i < 3; ++i)
+    {
+        masks[i]->reset(numberOfFaces);
+        for (const int faceIndex : logicals[i])
+        {
+            masks[i]->toggle(faceIndex);
+        }
+    }
+}
+
+void CodeGeometry::buildSyndromeEdges()
+{
+    auto &faceToEdges = lattice->getFaceToEdges();
+    // Every edge of a toric lattice is a stabilizer, other edge indices
+    // are never used
+    if (!boundaries)
+    {
+        syndromeMask.reset(numberOfEdges);
+        for (int i = 0; i < numberOfFaces; ++i)
+        {
+            for (const int edge : faceToEdges[i])
+            {
+                syndromeMask.set(edge);
+            }
+        }
+    }
+    syndromeIndexList.clear();
+    for (int edge = syndromeMask.next(0); edge < numberOfEdges; edge = syndromeMask.next(edge + 1))
+    {
+        syndromeIndexList.push_back(edge);
+    }
+    faceToSyndromeEdges = FlatLists<int>();
+    faceToSyndromeEdges.reserve(numberOfFaces);
+    vint edges;
+    for (int i = 0; i < numberOfFaces; ++i)
+    {
+        edges.clear();
+        for (const int edge : faceToEdges[i])
+        {
+            if (syndromeMask[edge])
+            {
+                edges.push_back(edge);
+            }
+        }
+        faceToSyndromeEdges.push_back(edges);
+    }
+}
+
+void CodeGeometry::buildCorrelatedIndices()
+{
+    auto &faceToEdges = lattice->getFaceToEdges();
+    // Faces of each edge, stored back to back
+    vint edgeFacesBegin(numberOfEdges + 1, 0);
+    for (int i = 0; i < numberOfFaces; ++i)
+    {
+        for (const int edge : faceToEdges[i])
+        {
+            ++edgeFacesBegin[edge + 1];
+        }
+    }
+    for (int edge = 0; edge < numberOfEdges; ++edge)
+    {
+        edgeFacesBegin[edge + 1] += edgeFacesBegin[edge];
+    }
+    vint edgeFaces(edgeFacesBegin.back());
+    vint position(edgeFacesBegin.begin(), edgeFacesBegin.end() - 1);
+    for (int i = 0; i < numberOfFaces; ++i)
+    {
+        for (const int edge : faceToEdges[i])
+        {
+            edgeFaces[position[edge]++] = i;
+        }
+    }
+    // Pairs (i, j > i) once for every shared edge, ordered by i then j
+    correlatedIndices.clear();
+    vint pairedFaces;
+    for (int i = 0; i < numberOfFaces; ++i)
+    {
+        pairedFaces.clear();
+        for (const int edge : faceToEdges[i])
+        {
+            for (int k = edgeFacesBegin[edge]; k < edgeFacesBegin[edge + 1]; ++k)
+            {
+                if (edgeFaces[k] > i)
+                {
+                    pairedFaces.push_back(edgeFaces[k]);
+                }
+            }
+        }
+        std::sort(pairedFaces.begin(), pairedFaces.end());
+        for (const int j : pairedFaces)
+        {
+            correlatedIndices.push_back({i, j});
+        }
+    }
+}
+
+void CodeGeometry::buildSweepStencil(const int facesPerBase)
+{
+    sweepStencil = SweepStencil();
+    // Code::stencilSweep keeps the edges of a vertex in one byte
+    if (boundaries || l < 4 || lattice->getEdgesPerOwner() > 8)
+    {
+        return;
+    }
+    const vdir sweepDirections = {Direction::xyz, Direction::xy, Direction::xz, Direction::yz,
+                                  -Direction::xyz, -Direction::xy, -Direction::xz, -Direction::yz};
+    auto &faceToVertices = lattice->getFaceToVertices();
+    const int edgesPerOwner = lattice->getEdgesPerOwner();
+    // Every (1 << siteShift)-th site of the w = 0 sub-lattice holds a vertex
+    int siteShift = 0;
+    while ((lattice->getNumberOfW0Vertices() << siteShift) < l * l * l)
+    {
+        ++siteShift;
+    }
+    for (int vertexIndex = 0; vertexIndex < lattice->getNumberOfW0Vertices(); ++vertexIndex)
+    {
+        const cartesian4 v = lattice->indexToCoordinate(vertexIndex);
+        if ((v.x + l * (v.y + l * v.z)) >> siteShift != vertexIndex)
+        {
+            return;
+        }
+    }
+    // Offset of vertex u from vertex v, false unless it is at most one step
+    // away along each axis
+    auto findOffset = [this](const cartesian4 &v, const int u, const int k, SweepStencil::Offset &offset) {
+        const cartesian4 coordinate = lattice->indexToCoordinate(u);
+        int d[3] = {coordinate.x - v.x, coordinate.y - v.y, coordinate.z - v.z};
+        for (int &x : d)
+        {
+            x = (x + l + 1) % l - 1;
+            if (x > 1)
+            {
+                return false;
+            }
+        }
+        offset = {static_cast<int8_t>(d[0]), static_cast<int8_t>(d[1]), static_cast<int8_t>(d[2]), static_cast<int8_t>(k)};
+        return true;
+    };
+    // Up-edges and other edges by direction index, then the slot faces
+    auto describe = [&](const int vertexIndex, std::vector<std::vector<SweepStencil::Offset>> &lists) {
+        const cartesian4 v = lattice->indexToCoordinate(vertexIndex);
+        lists.assign(29, {});
+        SweepStencil::Offset offset;
+        if (sweepTable.vertexClass[vertexIndex] == -1)
+        {
+            return true;
+        }
+        for (auto &direction : sweepDirections)
+        {
+            auto upEdges = lattice->getUpEdges(vertexIndex, direction);
+            for (const int edge : lattice->getVertexToEdges()[vertexIndex])
+            {
+                const bool up = std::find(upEdges.begin(), upEdges.end(), edge) != upEdges.end();
+                if (!up)
+                {
+                    if (!findOffset(v, lattice->getEdgeOwner(edge).vertex, edge % edgesPerOwner, offset))
+                    {
+                        return false;
+                    }
+                    lists[14 + direction.index()].push_back(offset);
+                }
+            }
+            for (const int edge : upEdges)
+            {
+                if (!findOffset(v, lattice->getEdgeOwner(edge).vertex, edge % edgesPerOwner, offset))
+                {
+                    return false;
+                }
+                lists[direction.index()].push_back(offset);
+            }
+        }
+        for (int i = sweepTable.vertexFacesBegin[vertexIndex]; i < sweepTable.vertexFacesBegin[vertexIndex + 1]; ++i)
+        {
+            const int face = sweepTable.vertexFaces[i];
+            if (face == -1)
+            {
+                return false;
+            }
+            // The base of a face is one of its vertices
+            const int base = face / facesPerBase;
+            auto vertices = faceToVertices[face];
+            auto it = std::find(vertices.begin(), vertices.end(), base);
+            if (it == vertices.end() || !findOffset(v, *it, face % facesPerBase, offset))
+            {
+                return false;
+            }
+            lists[28].push_back(offset);
+        }
+        return true;
+    };
+    // The first vertex of each type gives the stencil and every other vertex
+    // of the type must agree with it, types without vertices are never swept
+    const int numberOfTypes = 2 * (lattice->indexToCoordinate(lattice->getNumberOfVertices() - 1).w + 1);
+    vint typeClass(numberOfTypes, -2);
+    std::vector<std::vector<std::vector<SweepStencil::Offset>>> typeLists(numberOfTypes, std::vector<std::vector<SweepStencil::Offset>>(29));
+    std::vector<std::vector<SweepStencil::Offset>> lists;
+    for (int vertexIndex = 0; vertexIndex < lattice->getNumberOfVertices(); ++vertexIndex)
+    {
+        const int type = SweepStencil::type(lattice->indexToCoordinate(vertexIndex));
+        if (!describe(vertexIndex, lists))
+        {
+            return;
+        }
+        if (typeClass[type] == -2)
+        {
+            typeClass[type] = sweepTable.vertexClass[vertexIndex];
+            typeLists[type] = lists;
+        }
+        else if (typeClass[type] != sweepTable.vertexClass[vertexIndex] || typeLists[type] != lists)
+        {
+            return;
+        }
+    }
+    std::replace(typeClass.begin(), typeClass.end(), -2, -1);
+    SweepStencil &stencil = sweepStencil;
+    stencil.l = l;
+    stencil.siteShift = siteShift;
+    stencil.edgesPerOwner = edgesPerOwner;
+    stencil.facesPerBase = facesPerBase;
+    for (int i = -1; i <= l; ++i)
+    {
+        stencil.wrap.push_back((i + l) % l);
+    }
+    stencil.typeClass = typeClass;
+    for (auto &lists : typeLists)
+    {
+        for (int i = 0; i < 14; ++i)
+        {
+            stencil.upEdges.push_back(lists[i]);
+            stencil.otherEdges.push_back(lists[14 + i]);
+        }
+        stencil.faces.push_back(lists[28]);
+    }
+    // The stencil replaces the per-vertex tables
+    sweepTable.vertexClass = TableArray<int>();
+    sweepTable.vertexFacesBegin = TableArray<int>();
+    sweepTable.vertexFaces = TableArray<int>();
+}
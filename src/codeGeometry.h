@@ -0,0 +1,93 @@
+#ifndef CODE_GEOMETRY_H
+#define CODE_GEOMETRY_H
+
+#include "lattice.h"
+#include "bitSet.h"
+#include "sweepTable.h"
+#include "sweepStencil.h"
+#include <memory>
+
+// Read-only tables of a code, built once for each lattice type and size.
+// Any number of codes (decoder states) can point at the same geometry.
+struct CodeGeometry
+{
+  int l;
+  bool boundaries;
+  int numberOfFaces;
+  int numberOfEdges;
+  std::shared_ptr<Lattice> lattice;
+  BitVector syndromeMask; // one bit per edge, set for the edges which are stabilizers
+  vint syndromeIndexList; // the set bits of syndromeMask in order, for sampling errors
+  FlatLists<int> faceToSyndromeEdges; // edges of each face which are stabilizers
+  vint sweepIndices;
+  vint logicalZ1;
+  vint logicalZ2;
+  vint logicalZ3;
+  // Faces of each logical as a bit mask, for checking corrections
+  BitSet logicalMaskZ1;
+  BitSet logicalMaskZ2;
+  BitSet logicalMaskZ3;
+  vpint correlatedIndices; // pairs of faces which share an edge
+  // With a stencil the sweep table keeps only the decisions and slots of
+  // each rule class, the stencil gives the class and faces of every vertex
+  SweepTable sweepTable;
+  SweepStencil sweepStencil; // empty unless the code is toric
+
+  // Rule class of a vertex, -1 if it is never swept
+  int sweepClass(const int vertexIndex) const
+  {
+    if (sweepStencil.empty())
+    {
+      return sweepTable.vertexClass[vertexIndex];
+    }
+    return sweepStencil.typeClass[SweepStencil::type(lattice->indexToCoordinate(vertexIndex))];
+  }
+  // Face of a slot of the rule class of a vertex, -1 if the face is missing
+  int slotFace(const int vertexIndex, const int slot) const
+  {
+    if (sweepStencil.empty())
+    {
+      return sweepTable.vertexFaces[sweepTable.vertexFacesBegin[vertexIndex] + slot];
+    }
+    const cartesian4 coordinate = lattice->indexToCoordinate(vertexIndex);
+    return sweepStencil.face(coordinate, sweepStencil.faces[SweepStencil::type(coordinate)][slot]);
+  }
+
+  void buildLogicalMasks();
+  // Needs the faces and, with boundaries, the syndromeMask set by
+  // buildSyndromeIndices. Builds the syndromeMask of toric codes and the
+  // syndromeIndexList and faceToSyndromeEdges of every code
+  void buildSyndromeEdges();
+  void buildCorrelatedIndices();
+  // Needs the sweep table. Faces must be numbered facesPerBase at a time for
+  // every vertex of the w = 0 sub-lattice, the stencil is left empty if the
+  // sweep rule does not repeat along the lattice. Once the stencil is built
+  // the per-vertex tables of the sweep table are dropped
+  void buildSweepStencil(const int facesPerBase);
+
+  // Every table except correlatedIndices, which is only built for correlated
+  // errors. See Lattice::transferTables
+  template <typename Tables>
+  void transferTables(Tables &tables)
+  {
+    tables(l);
+    tables(boundaries);
+    tables(numberOfFaces);
+    tables(numberOfEdges);
+    lattice->transferTables(tables);
+    syndromeMask.transferTables(tables);
+    tables(syndromeIndexList);
+    faceToSyndromeEdges.transferTables(tables);
+    tables(sweepIndices);
+    tables(logicalZ1);
+    tables(logicalZ2);
+    tables(logicalZ3);
+    logicalMaskZ1.transferTables(tables);
+    logicalMaskZ2.transferTables(tables);
+    logicalMaskZ3.transferTables(tables);
+    sweepTable.transferTables(tables);
+    sweepStencil.transferTables(tables);
+  }
+};
+
+#endif
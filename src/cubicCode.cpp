@@ -5,54 +5,89 @@
 #include <string>
 #include <algorithm>
 
-CubicCode::CubicCode(const int l, const double p, const double q, bool boundaries, const int sweepRate) : Code(l, p, q, boundaries, sweepRate)
+CubicCode::CubicCode(const int l, const double p, const double q, bool boundaries, const int sweepRate) : CubicCode(buildGeometry(l, boundaries), p, q, sweepRate)
+{
+}
+
+CubicCode::CubicCode(std::shared_ptr<const CodeGeometry> geometry, const double p, const double q, const int sweepRate) : Code(geometry, p, q, sweepRate)
+{
+}
+
+std::shared_ptr<Lattice> CubicCode::buildLattice(const int l, bool boundaries)
 {
     if (boundaries)
     {
-        numberOfFaces = 3 * pow(l - 1, 3) - 4 * pow(l - 1, 2) + 2 * (l - 1);
-        lattice = std::make_unique<CubicLattice>(l);
-        buildSyndromeIndices();
+        return std::make_shared<CubicLattice>(l);
     }
-    else
+    return std::make_shared<CubicToricLattice>(l);
+}
+
+std::shared_ptr<CodeGeometry> CubicCode::buildGeometry(const int l, bool boundaries)
+{
+    auto geometry = std::make_shared<CodeGeometry>();
+    geometry->l = l;
+    geometry->boundaries = boundaries;
+    geometry->lattice = buildLattice(l, boundaries);
+    if (boundaries)
     {
-        numberOfFaces = 3 * pow(l, 3);
-        lattice = std::make_unique<CubicToricLattice>(l);
+        geometry->numberOfFaces = 3 * pow(l - 1, 3) - 4 * pow(l - 1, 2) + 2 * (l - 1);
+        buildSyndromeIndices(*geometry);
     }
-    numberOfEdges = 7 * pow(l, 3);
-    buildSweepIndices();
-    syndrome.assign(numberOfEdges, 0);
-    flipBits.assign(numberOfFaces, 0);
-    lattice->createFaces();
-    lattice->createUpEdgesMap();
-    lattice->createVertexToEdges();
-    upEdgesMap = lattice->getUpEdgesMap();
-    faceToEdges = lattice->getFaceToEdges(); 
-    vertexToEdges = lattice->getVertexToEdges();
-    buildLogicals();
+    else
+    {
+        geometry->numberOfFaces = 3 * pow(l, 3);
+    }
+    geometry->numberOfEdges = geometry->lattice->getNumberOfEdges();
+    buildSweepIndices(*geometry);
+    geometry->lattice->createFaces();
+    geometry->lattice->createUpEdgesMap();
+    geometry->lattice->createVertexToEdges();
+    buildLogicals(*geometry);
+    geometry->buildLogicalMasks();
+    geometry->buildSyndromeEdges();
+    geometry->sweepTable = CubicCode(geometry, 0, 0, 1).buildSweepTable();
+    // Three faces for every vertex
+    geometry->buildSweepStencil(3);
+    return geometry;
+}
+
+std::unique_ptr<Code> CubicCode::clone() const
+{
+    return std::make_unique<CubicCode>(*this);
 }
 
-void CubicCode::buildSyndromeIndices()
+void CubicCode::buildSyndromeIndices(CodeGeometry &geometry)
 {
+    const int l = geometry.l;
+    auto &lattice = geometry.lattice;
+    auto &syndromeMask = geometry.syndromeMask;
+    syndromeMask.reset(lattice->getNumberOfEdges());
+
     for (int i = 0; i < pow(l, 3); ++i)
     {
         const cartesian4 coordinate = lattice->indexToCoordinate(i);
         if (coordinate.z < l - 2 && coordinate.x > 0 && coordinate.x < l - 1 && coordinate.y > 0 && coordinate.y < l - 1)
         {
-            syndromeIndices.insert(lattice->edgeIndex(i, "z", 1));
+            syndromeMask.set(lattice->edgeIndex(i, Direction::z, 1));
         }
         if (coordinate.z < l - 1 && coordinate.x > 0 && coordinate.x < l - 1 && coordinate.y < l - 1)
         {
-            syndromeIndices.insert(lattice->edgeIndex(i, "y", 1));
+            syndromeMask.set(lattice->edgeIndex(i, Direction::y, 1));
         }
         if (coordinate.z < l - 1 && coordinate.y > 0 && coordinate.y < l - 1 && coordinate.x < l - 1)
         {
-            syndromeIndices.insert(lattice->edgeIndex(i, "x", 1));
+            syndromeMask.set(lattice->edgeIndex(i, Direction::x, 1));
         }
     }
 }
 
-void CubicCode::buildSweepIndices()
+void CubicCode::buildSweepIndices(CodeGeometry &geometry)
 {
+    const int l = geometry.l;
+    auto &lattice = geometry.lattice;
+    const bool boundaries = geometry.boundaries;
+    auto &sweepIndices = geometry.sweepIndices;
+
     if (boundaries)
     {
         for (int i = 0; i < pow(l, 3); ++i)
@@ -67,151 +102,90 @@ void CubicCode::buildSweepIndices()
     else
     {
         sweepIndices.assign(pow(l, 3), 0);
-        std::iota(std::begin(sweepIndices), std::end(sweepIndices), 0);
+        std::iota(sweepIndices.begin(), sweepIndices.end(), 0);
     }
 }
 
-void CubicCode::sweep(const std::string &direction, bool greedy)
+vdir CubicCode::sweepEdgeDirections(const SignedDirection &direction)
 {
-    clearFlipBits();
-    vstr edgeDirections;
-    if (direction == "xyz")
+    vdir edgeDirections;
+    if (direction == Direction::xyz)
     {
-        edgeDirections = {"x", "y", "z"};
+        edgeDirections = {Direction::x, Direction::y, Direction::z};
     }
-    else if (direction == "xy")
+    else if (direction == Direction::xy)
     {
-        edgeDirections = {"x", "y", "-z"};
+        edgeDirections = {Direction::x, Direction::y, -Direction::z};
     }
-    else if (direction == "xz")
+    else if (direction == Direction::xz)
     {
-        edgeDirections = {"x", "-y", "z"};
+        edgeDirections = {Direction::x, -Direction::y, Direction::z};
     }
-    else if (direction == "yz")
+    else if (direction == Direction::yz)
     {
-        edgeDirections = {"-x", "y", "z"};
+        edgeDirections = {-Direction::x, Direction::y, Direction::z};
     }
-    else if (direction == "-xyz")
+    else if (direction == -Direction::xyz)
     {
-        edgeDirections = {"-x", "-y", "-z"};
+        edgeDirections = {-Direction::x, -Direction::y, -Direction::z};
     }
-    else if (direction == "-xy")
+    else if (direction == -Direction::xy)
     {
-        edgeDirections = {"-x", "-y", "z"};
+        edgeDirections = {-Direction::x, -Direction::y, Direction::z};
     }
-    else if (direction == "-xz")
+    else if (direction == -Direction::xz)
     {
-        edgeDirections = {"-x", "y", "-z"};
+        edgeDirections = {-Direction::x, Direction::y, -Direction::z};
     }
-    else if (direction == "-yz")
+    else if (direction == -Direction::yz)
     {
-        edgeDirections = {"x", "-y", "-z"};
+        edgeDirections = {Direction::x, -Direction::y, -Direction::z};
     }
     else
     {
         throw std::invalid_argument("Invalid sweep direction.");
     }
-    for (auto const vertexIndex : sweepIndices)
+    return edgeDirections;
+}
+
+void CubicCode::sweepVertex(const int vertexIndex, const SignedDirection &direction, const vdir &edgeDirections)
+{
+    vdir sweepEdges = findSweepEdges(vertexIndex, direction);
+    if (sweepEdges.size() > 3)
     {
-        if (!greedy)
-        {
-            if (!checkExtremalVertex(vertexIndex, direction))
-            {
-                continue;
-            }
-        }
-        vstr sweepEdges = findSweepEdges(vertexIndex, direction);
-        if (sweepEdges.size() > 3)
-        {
-            throw std::length_error("More than three up-edges found for a cubic lattice vertex.");
-        }
-        if (sweepEdges.size() < 2)
-        {
-            continue;
-        }
-        cellularAutomatonStep(vertexIndex, sweepEdges, direction, edgeDirections);
+        throw std::length_error("More than three up-edges found for a cubic lattice vertex.");
     }
-    for (int i = 0, imax = flipBits.size(); i < imax; ++i)
+    if (sweepEdges.size() < 2)
     {
-        if (flipBits[i])
-        {
-            auto it = error.find(i);
-            if (it != error.end())
-            {
-                error.erase(it);
-            }
-            else
-            {
-                error.insert(i);
-            }
-            if (sweepRate > 1)
-            {
-                for (const int edge : faceToEdges[i])
-                {
-                    // std::cerr << edge << std::endl;
-                    if (boundaries)
-                    {
-                        auto it2 = syndromeIndices.find(edge);
-                        if (it2 == syndromeIndices.end())
-                        {
-                            continue;
-                        }
-                    }
-                    syndrome[edge] = (syndrome[edge] + 1) % 2;
-                }
-            }
-        }
+        return;
     }
+    cellularAutomatonStep(vertexIndex, sweepEdges, direction, edgeDirections);
 }
 
-void CubicCode::cellularAutomatonStep(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections)
+void CubicCode::cellularAutomatonStep(const int vertexIndex, vdir &sweepEdges, const SignedDirection &sweepDirection, const vdir &upEdgeDirections)
 {
     auto &edge0 = upEdgeDirections[0];
     auto &edge1 = upEdgeDirections[1];
     auto &edge2 = upEdgeDirections[2];
     if (sweepEdges.size() == 3)
     {
-        int delIndex = distInt0To2(rnEngine);
+        int delIndex = randomChoice(3);
         sweepEdges.erase(sweepEdges.begin() + delIndex);
     }
     if ((sweepEdges[0] == edge0 && sweepEdges[1] == edge2) ||
         (sweepEdges[0] == edge2 && sweepEdges[1] == edge0))
     {
-        vint vertices;
-        try
-        {
-            vertices = faceVertices(vertexIndex, {edge0, edge2, edge2});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-        }
+        flipFace(vertexIndex, {edge0, edge2, edge2});
     }
     else if ((sweepEdges[0] == edge0 && sweepEdges[1] == edge1) ||
              (sweepEdges[0] == edge1 && sweepEdges[1] == edge0))
     {
-        vint vertices;
-        try
-        {
-            vertices = faceVertices(vertexIndex, {edge0, edge1, edge1});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-        }
+        flipFace(vertexIndex, {edge0, edge1, edge1});
     }
     else if ((sweepEdges[0] == edge1 && sweepEdges[1] == edge2) ||
              (sweepEdges[0] == edge2 && sweepEdges[1] == edge1))
     {
-        vint vertices;
-        try
-        {
-            vertices = faceVertices(vertexIndex, {edge2, edge1, edge1});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-        }
+        flipFace(vertexIndex, {edge2, edge1, edge1});
     }
     else
     {
@@ -219,104 +193,37 @@ void CubicCode::cellularAutomatonStep(const int vertexIndex, vstr &sweepEdges, c
     }
 }
 
-vstr CubicCode::findSweepEdges(const int vertexIndex, const std::string &direction)
+vdir CubicCode::findSweepEdges(const int vertexIndex, const SignedDirection &direction)
 {
-    vstr sweepEdges;
-    auto &upEdges = upEdgesMap[direction][vertexIndex];
+    vdir sweepEdges;
+    auto upEdges = lattice->getUpEdges(vertexIndex, direction);
     for (const int edge : upEdges)
     {
         if (syndrome[edge] == 1)
         {
-            int xEdge = -1, yEdge = -1, zEdge = -1;
-            int minusXEdge = -1, minusYEdge = -1, minusZEdge = -1;
-            try
-            {
-                xEdge = lattice->edgeIndex(vertexIndex, "x", 1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                yEdge = lattice->edgeIndex(vertexIndex, "y", 1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                zEdge = lattice->edgeIndex(vertexIndex, "z", 1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                minusXEdge = lattice->edgeIndex(vertexIndex, "x", -1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                minusYEdge = lattice->edgeIndex(vertexIndex, "y", -1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                minusZEdge = lattice->edgeIndex(vertexIndex, "z", -1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            if (xEdge == edge)
-            {
-                sweepEdges.push_back("x");
-            }
-            else if (yEdge == edge)
-            {
-                sweepEdges.push_back("y");
-            }
-            else if (zEdge == edge)
-            {
-                sweepEdges.push_back("z");
-            }
-            else if (minusXEdge == edge)
-            {
-                sweepEdges.push_back("-x");
-            }
-            else if (minusYEdge == edge)
-            {
-                sweepEdges.push_back("-y");
-            }
-            else if (minusZEdge == edge)
-            {
-                sweepEdges.push_back("-z");
-            }
-            else
-            {
-                throw std::invalid_argument("Edge index does not correspond to a valid edge.");
-            }
+            sweepEdges.push_back(lattice->edgeDirection(edge, vertexIndex));
         }
     }
     return sweepEdges;
 }
 
-void CubicCode::buildLogicals()
+void CubicCode::buildLogicals(CodeGeometry &geometry)
 {
+    const int l = geometry.l;
+    auto &lattice = geometry.lattice;
+    const bool boundaries = geometry.boundaries;
+
     for (int i = 0; i < l - 1; ++i)
     {
         cartesian4 coordinate{0, 0, i, 0};
         int vertexIndex = lattice->coordinateToIndex(coordinate);
-        int neighbourVertex = lattice->neighbour(vertexIndex, "x", 1);
+        int neighbourVertex = lattice->neighbour(vertexIndex, Direction::x, 1);
         vint faceVertices = {vertexIndex,
                                 neighbourVertex,
-                                lattice->neighbour(vertexIndex, "y", 1),
-                                lattice->neighbour(neighbourVertex, "y", 1)};
+                                lattice->neighbour(vertexIndex, Direction::y, 1),
+                                lattice->neighbour(neighbourVertex, Direction::y, 1)};
         std::sort(faceVertices.begin(), faceVertices.end());
-        logicalZ1.push_back(lattice->findFace(faceVertices));
+        geometry.logicalZ1.push_back(lattice->findFace(faceVertices));
     }
     if (!boundaries)
     {
@@ -324,25 +231,25 @@ void CubicCode::buildLogicals()
         {
             cartesian4 coordinate{i, 0, 0, 0};
             int vertexIndex = lattice->coordinateToIndex(coordinate);
-            int neighbourVertex = lattice->neighbour(vertexIndex, "y", 1);
+            int neighbourVertex = lattice->neighbour(vertexIndex, Direction::y, 1);
             vint faceVertices = {vertexIndex,
                                     neighbourVertex,
-                                    lattice->neighbour(vertexIndex, "z", 1),
-                                    lattice->neighbour(neighbourVertex, "z", 1)};
+                                    lattice->neighbour(vertexIndex, Direction::z, 1),
+                                    lattice->neighbour(neighbourVertex, Direction::z, 1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ2.push_back(lattice->findFace(faceVertices));
+            geometry.logicalZ2.push_back(lattice->findFace(faceVertices));
         }
         for (int i = 0; i < l - 1; ++i)
         {
             cartesian4 coordinate{0, i, 0, 0};
             int vertexIndex = lattice->coordinateToIndex(coordinate);
-            int neighbourVertex = lattice->neighbour(vertexIndex, "x", 1);
+            int neighbourVertex = lattice->neighbour(vertexIndex, Direction::x, 1);
             vint faceVertices = {vertexIndex,
                                     neighbourVertex,
-                                    lattice->neighbour(vertexIndex, "z", 1),
-                                    lattice->neighbour(neighbourVertex, "z", 1)};
+                                    lattice->neighbour(vertexIndex, Direction::z, 1),
+                                    lattice->neighbour(neighbourVertex, Direction::z, 1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ3.push_back(lattice->findFace(faceVertices));
+            geometry.logicalZ3.push_back(lattice->findFace(faceVertices));
         }
     }
 }
@@ -7,14 +7,21 @@ class CubicCode : public Code
 {
   public:
     CubicCode(const int latticeLength, const double dataErrorProbability, const double measErrorProbability, bool boundaries, const int sweepRate);
+    CubicCode(std::shared_ptr<const CodeGeometry> geometry, const double dataErrorProbability, const double measErrorProbability, const int sweepRate);
 
-    void buildSyndromeIndices();
-    void buildSweepIndices();
-    void sweep(const std::string &direction, bool greedy);
-    vstr findSweepEdges(const int vertexIndex, const std::string &direction);
-    void buildLogicals();
+    static std::shared_ptr<CodeGeometry> buildGeometry(const int latticeLength, bool boundaries);
+    // The lattice of a geometry before any of its tables are created
+    static std::shared_ptr<Lattice> buildLattice(const int latticeLength, bool boundaries);
+    static void buildSyndromeIndices(CodeGeometry &geometry);
+    static void buildSweepIndices(CodeGeometry &geometry);
+    static void buildLogicals(CodeGeometry &geometry);
+    using Code::findSweepEdges;
+    vdir findSweepEdges(const int vertexIndex, const SignedDirection &direction);
+    vdir sweepEdgeDirections(const SignedDirection &direction);
+    void sweepVertex(const int vertexIndex, const SignedDirection &direction, const vdir &edgeDirections);
+    std::unique_ptr<Code> clone() const;
 
-    void cellularAutomatonStep(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections);
+    void cellularAutomatonStep(const int vertexIndex, vdir &sweepEdges, const SignedDirection &sweepDirection, const vdir &upEdgeDirections);
 
 };
 
@@ -5,7 +5,6 @@
 #include <cmath>
 #include <algorithm>
 #include <map>
-#include <sstream>
 
 CubicLattice::CubicLattice(const int l) : Lattice(l)
 {
@@ -16,17 +15,18 @@ CubicLattice::CubicLattice(const int l) : Lattice(l)
     int numberOfFaces = 3 * pow(l - 1, 3) - 4 * pow(l - 1, 2) + 2 * (l - 1);
     faceToVertices.reserve(numberOfFaces);
     faceToEdges.reserve(numberOfFaces);
-    vertexToFaces.assign(pow(l, 3), {});
-    vertexToEdges.assign(pow(l, 3), {});
+    numberVertices(1, -1);
+    createNeighbours({Direction::x, Direction::y, Direction::z});
+    numberEdges({Direction::x, Direction::y, Direction::z});
 }
 
-int CubicLattice::neighbour(const int vertexIndex, const std::string &direction, const int sign)
+int CubicLattice::computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const
 {
     if (!(sign == 1 || sign == -1))
     {
         throw std::invalid_argument("Sign must be either 1 or -1.");
     }
-    if (!(direction == "x" || direction == "y" || direction == "z"))
+    if (!(direction == Direction::x || direction == Direction::y || direction == Direction::z))
     {
         throw std::invalid_argument("Direction must be one of 'x', 'y' or 'z'.");
     }
@@ -38,40 +38,24 @@ int CubicLattice::neighbour(const int vertexIndex, const std::string &direction,
     }
     else
     {
-        if (direction == "x")
+        if (direction == Direction::x)
         {
             coordinate.x = coordinate.x + sign;
         }
-        else if (direction == "y")
+        else if (direction == Direction::y)
         {
             coordinate.y = coordinate.y + sign;
         }
-        else if (direction == "z")
+        else if (direction == Direction::z)
         {
             coordinate.z = coordinate.z + sign;
         }
     }
     if (coordinate.x < 0 || coordinate.x >= l || coordinate.y < 0 || coordinate.y >= l || coordinate.z < 0 || coordinate.z >= l)
     {
-        std::ostringstream stream;
-        cartesian4 errorCoord = indexToCoordinate(vertexIndex);
-        std::string errorDir;
-        if (sign == 1)
-        {
-            errorDir = "+" + direction;
-        }
-        else if (sign == -1)
-        {
-            errorDir = "-" + direction;
-        }
-        stream << "CubicLattice::neighbour, " << errorDir << " neighbour of " << errorCoord << " is outside the lattice.";
-        std::string errorMessage = stream.str();
-        throw std::invalid_argument(errorMessage);
-    }
-    else
-    {
-        return coordinateToIndex(coordinate);
+        return -1;
     }
+    return coordinateToIndex(coordinate);
 }
 
 void CubicLattice::createFaces()
@@ -103,6 +87,7 @@ void CubicLattice::createFaces()
         addFace(vertexIndex, faceIndex, {"x", "y", "y", "x"}, {1, 1, 1, 1});
         ++faceIndex;
     }
+    indexFaces();
 }
 
 void CubicLattice::createUpEdgesMap()
@@ -118,249 +103,70 @@ void CubicLattice::createUpEdgesMap()
             // cartesian4 coordinate = indexToCoordinate(vertexIndex);
             if (direction == "xyz")
             {
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                    // Edge to vertex outside lattice
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::x, 1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::y, 1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::z, 1});
             }
             else if (direction == "xy")
             {
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::x, 1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::y, 1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::z, -1});
             }
             else if (direction == "xz")
             {
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::x, 1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::y, -1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::z, 1});
             }
             else if (direction == "yz")
             {
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::x, -1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::y, 1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::z, 1});
             }
             else if (direction == "-xyz")
             {
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::x, -1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::y, -1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::z, -1});
             }
             else if (direction == "-xy")
             {
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::x, -1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::y, -1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::z, 1});
             }
             else if (direction == "-xz")
             {
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::x, -1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::y, 1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::z, -1});
             }
             else if (direction == "-yz")
             {
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", 1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
-                try
-                {
-                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", -1));
-                }
-                catch(const std::invalid_argument& e)
-                {
-                }
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::x, 1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::y, -1});
+                addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::z, -1});
             }
         }
-        upEdgesMap.insert(std::pair<std::string, vvint>(direction, vertexToUpEdges));
+        addUpEdges(direction, vertexToUpEdges);
     }
 }
 
 void CubicLattice::createVertexToEdges()
 {
+    vvint edges(numberOfVertices);
     for (int vertexIndex = 0; vertexIndex < pow(l, 3); ++vertexIndex)
     {
         // cartesian4 coordinate = indexToCoordinate(vertexIndex);
-        try 
-        {
-            vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", 1));
-        }
-        catch(const std::invalid_argument& e)
-        {
-            // Invalid edge
-        }
-        try 
-        {
-            vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", 1));
-        }
-        catch(const std::invalid_argument& e)
-        {
-        }
-        try 
-        {
-            vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", 1));
-        }
-        catch(const std::invalid_argument& e)
-        {
-        }
-        try 
-        {
-            vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", -1));
-        }
-        catch(const std::invalid_argument& e)
-        {
-        }
-        try 
-        {
-            vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", -1));
-        }
-        catch(const std::invalid_argument& e)
-        {
-        }
-        try 
-        {
-            vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", -1));
-        }
-        catch(const std::invalid_argument& e)
-        {
-        }
+        addEdge(edges[vertexIndex], vertexIndex, {Direction::x, 1});
+        addEdge(edges[vertexIndex], vertexIndex, {Direction::y, 1});
+        addEdge(edges[vertexIndex], vertexIndex, {Direction::z, 1});
+        addEdge(edges[vertexIndex], vertexIndex, {Direction::x, -1});
+        addEdge(edges[vertexIndex], vertexIndex, {Direction::y, -1});
+        addEdge(edges[vertexIndex], vertexIndex, {Direction::z, -1});
     }
+    vertexToEdges = FlatLists<int>(edges);
+    indexEdges();
 }
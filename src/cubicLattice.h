@@ -8,7 +8,7 @@ class CubicLattice : public Lattice
   private:
   public:
     CubicLattice(const int l);
-    int neighbour(const int vertexIndex, const std::string &direction, const int sign);
+    int computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const;
     void createFaces();
     void createVertexToEdges();
     void createUpEdgesMap();
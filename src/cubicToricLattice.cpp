@@ -12,17 +12,18 @@ CubicToricLattice::CubicToricLattice(const int l) : Lattice(l)
     int numberOfFaces = 3 * pow(l, 3);
     faceToVertices.reserve(numberOfFaces);
     faceToEdges.reserve(numberOfFaces);
-    vertexToFaces.assign(pow(l, 3), {});
-    vertexToEdges.assign(pow(l, 3), {});
+    numberVertices(1, -1);
+    createNeighbours({Direction::x, Direction::y, Direction::z});
+    numberEdges({Direction::x, Direction::y, Direction::z});
 }
 
-int CubicToricLattice::neighbour(const int vertexIndex, const std::string &direction, const int sign)
+int CubicToricLattice::computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const
 {
     if (!(sign == 1 || sign == -1))
     {
         throw std::invalid_argument("Sign must be either 1 or -1.");
     }
-    if (!(direction == "x" || direction == "y" || direction == "z"))
+    if (!(direction == Direction::x || direction == Direction::y || direction == Direction::z))
     {
         throw std::invalid_argument("Direction must be one of 'x', 'y' or 'z'.");
     }
@@ -34,15 +35,15 @@ int CubicToricLattice::neighbour(const int vertexIndex, const std::string &direc
     }
     else
     {
-        if (direction == "x")
+        if (direction == Direction::x)
         {
             coordinate.x = (l + ((coordinate.x + sign) % l)) % l;
         }
-        else if (direction == "y")
+        else if (direction == Direction::y)
         {
             coordinate.y = (l + ((coordinate.y + sign) % l)) % l;
         }
-        else if (direction == "z")
+        else if (direction == Direction::z)
         {
             coordinate.z = (l + ((coordinate.z + sign) % l)) % l;
         }
@@ -64,6 +65,7 @@ void CubicToricLattice::createFaces()
         addFace(vertexIndex, faceIndex, {"y", "z", "z", "y"}, {1, 1, 1, 1});
         ++faceIndex;
     }
+    indexFaces();
 }
 
 void CubicToricLattice::createUpEdgesMap()
@@ -127,19 +129,22 @@ void CubicToricLattice::createUpEdgesMap()
                 vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", -1));
             }
         }
-        upEdgesMap.insert(std::pair<std::string, vvint>(direction, vertexToUpEdges));
+        addUpEdges(direction, vertexToUpEdges);
     }
 }
 
 void CubicToricLattice::createVertexToEdges()
 {
+    vvint edges(numberOfVertices);
     for (int vertexIndex = 0; vertexIndex < pow(l, 3); ++vertexIndex)
     {
-        vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", 1));
-        vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", 1));
-        vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", 1));
-        vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", -1));
-        vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", -1));
-        vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", -1));
+        edges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", 1));
+        edges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", 1));
+        edges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", 1));
+        edges[vertexIndex].push_back(edgeIndex(vertexIndex, "x", -1));
+        edges[vertexIndex].push_back(edgeIndex(vertexIndex, "y", -1));
+        edges[vertexIndex].push_back(edgeIndex(vertexIndex, "z", -1));
     }
+    vertexToEdges = FlatLists<int>(edges);
+    indexEdges();
 }
\ No newline at end of file
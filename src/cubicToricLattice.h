@@ -7,7 +7,7 @@ class CubicToricLattice : public Lattice
 {
   public:
     CubicToricLattice(const int l);
-    int neighbour(const int vertexIndex, const std::string &direction, const int sign);
+    int computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const;
     void createFaces();
     void createVertexToEdges();
     void createUpEdgesMap();
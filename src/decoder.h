@@ -4,16 +4,53 @@
 #include <string>
 #include "rhombicCode.h"
 #include "cubicCode.h"
+#include "bitSlicedCode.h"
+#include "geometryCache.h"
+#include "parameterGrid.h"
 #include <algorithm>
 #include <cmath>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <random>
 #include "pcg_random.hpp"
 
-pcg_extras::seed_seq_from<std::random_device> seed;
-pcg32 rnEngine(seed);
+// Seed for a run when none is given
+inline uint64_t randomSeed()
+{
+    std::random_device device;
+    return (uint64_t(device()) << 32) | device();
+}
 
-// std::mt19937 rnEngine(time(0)); // Valgrind doesn't like pcg
+// Random state of one trial. Trial t of a run draws its errors from PCG stream
+// 2t and its random sweep schedule from stream 2t + 1 of the run seed, so a
+// trial gives the same result whichever thread runs it and can be replayed
+// on its own
+struct runContext
+{
+    uint64_t seed;
+    uint64_t trial;
+    pcg32 scheduleEngine;
+    std::uniform_int_distribution<int> distInt0To7;
+    // Unsatisfied stabilizers after the sweeps of each round and then after
+    // each readout sweep, read from the code's running count. Only recorded
+    // when recordSyndromeWeights is set
+    bool recordSyndromeWeights = false;
+    vint syndromeWeights;
+    int readoutSweeps; // sweeps until the syndrome was clean or the timeout
 
-std::uniform_int_distribution<int> distInt0To7(0, 7);
+    runContext(const uint64_t seed, const uint64_t trial) : seed(seed),
+                                                            trial(trial),
+                                                            scheduleEngine(seed, 2 * trial + 1),
+                                                            distInt0To7(0, 7) {}
+};
 
 // std::vector<bool> runToric(const int l, const int rounds,
 //                            const double p, const double q,
@@ -23,7 +60,7 @@ std::uniform_int_distribution<int> distInt0To7(0, 7);
 // {
 //     std::vector<bool> success = {false, false};
 //     RhombicCode code = RhombicCode(l, p, q, false);
-//     std::vector<int8_t> &syndrome = code.getSyndrome();
+//     BitVector &syndrome = code.getSyndrome();
 //     for (int r = 0; r < rounds; ++r)
 //     {
 //         code.generateDataError(correlatedErrors);
@@ -51,43 +88,110 @@ std::uniform_int_distribution<int> distInt0To7(0, 7);
 //     return success;
 // }
 
-std::vector<bool> oneRun(const int l, const int rounds,
-                                const double p, const double q,
-                                const int sweepLimit,
-                                const std::string sweepSchedule,
-                                const int timeout,
-                                const std::string latticeType,
-                                bool greedy,
-                                bool correlatedErrors, 
-                                const int sweepRate)
+struct trialResult
 {
-    std::vector<bool> success = {false, false};
-    std::unique_ptr<Code> code;
-    if (latticeType == "rhombic_boundaries")
+    bool success;
+    bool cleanSyndrome;
+    double time; // seconds
+    int readoutSweeps;
+    vint syndromeWeights; // empty unless they were asked for, see runContext
+};
+
+struct trialStatistics
+{
+    int successes;
+    int cleanSyndromes;
+    std::vector<trialResult> results;
+};
+
+// Builds the lattice, stabilizers and logicals of a code, these never change
+// during a run so one geometry can be shared by any number of codes. With a
+// geometryCache directory the geometry is read from there if an earlier run
+// saved it with the same rules, and saved there otherwise.
+inline std::shared_ptr<const CodeGeometry> buildGeometry(const int l,
+                                                  const std::string latticeType,
+                                                  bool correlatedErrors,
+                                                  const std::string &geometryCache = "")
+{
+    std::shared_ptr<CodeGeometry> (*build)(const int, bool);
+    std::shared_ptr<Lattice> (*buildLattice)(const int, bool);
+    bool boundaries;
+    if (latticeType == "rhombic_boundaries" || latticeType == "rhombic_toric")
+    {
+        build = RhombicCode::buildGeometry;
+        buildLattice = RhombicCode::buildLattice;
+        boundaries = latticeType == "rhombic_boundaries";
+    }
+    else if (latticeType == "cubic_boundaries" || latticeType == "cubic_toric")
     {
-        code = std::make_unique<RhombicCode>(l, p, q, true, sweepRate);
+        build = CubicCode::buildGeometry;
+        buildLattice = CubicCode::buildLattice;
+        boundaries = latticeType == "cubic_boundaries";
     }
-    else if (latticeType == "cubic_boundaries")
+    else
     {
-        code = std::make_unique<CubicCode>(l, p, q, true, sweepRate);
+        throw std::invalid_argument("Invalid lattice type.");
     }
-    else if (latticeType == "rhombic_toric")
+    std::shared_ptr<CodeGeometry> geometry;
+    if (geometryCache.empty())
     {
-        code = std::make_unique<RhombicCode>(l, p, q, false, sweepRate);
+        geometry = build(l, boundaries);
     }
-    else if (latticeType == "cubic_toric")
+    else
     {
-        code = std::make_unique<CubicCode>(l, p, q, false, sweepRate);
+        GeometryCache cache(geometryCache);
+        const uint64_t rules = GeometryCache::fingerprint(*build(GeometryCache::fingerprintL, boundaries));
+        geometry = cache.load(latticeType, l, buildLattice(l, boundaries), rules);
+        if (!geometry)
+        {
+            geometry = build(l, boundaries);
+            if (!cache.save(latticeType, *geometry, rules))
+            {
+                std::cerr << "Could not save the geometry to " << cache.path(latticeType, l) << std::endl;
+            }
+        }
     }
     if (correlatedErrors)
     {
-        code->buildCorrelatedIndices();
+        geometry->buildCorrelatedIndices();
     }
-    std::vector<int8_t> &syndrome = code->getSyndrome();
+    return geometry;
+}
+
+inline std::unique_ptr<Code> buildCode(std::shared_ptr<const CodeGeometry> geometry,
+                                const double p, const double q,
+                                const std::string latticeType,
+                                const int sweepRate)
+{
+    if (latticeType == "rhombic_boundaries" || latticeType == "rhombic_toric")
+    {
+        return std::make_unique<RhombicCode>(geometry, p, q, sweepRate);
+    }
+    else if (latticeType == "cubic_boundaries" || latticeType == "cubic_toric")
+    {
+        return std::make_unique<CubicCode>(geometry, p, q, sweepRate);
+    }
+    else
+    {
+        throw std::invalid_argument("Invalid lattice type.");
+    }
+}
+
+inline std::unique_ptr<Code> buildCode(const int l,
+                                const double p, const double q,
+                                const std::string latticeType,
+                                bool correlatedErrors,
+                                const int sweepRate)
+{
+    return buildCode(buildGeometry(l, latticeType, correlatedErrors), p, q, latticeType, sweepRate);
+}
+
+// Directions of a sweep schedule, in the order they are used. The random
+// schedule picks one of the eight directions at random instead
+inline vstr scheduleDirections(const std::string &sweepSchedule, bool &randomSchedule)
+{
     vstr sweepDirections = {"xyz", "xy", "xz", "yz", "-xyz", "-xy", "-xz", "-yz"}; // Used by random schedule
-    bool randomSchedule = false;
-    int sweepIndex = 0;
-    int sweepCount = 0;
+    randomSchedule = false;
     if (sweepSchedule == "rotating_XZ")
     {
         sweepDirections = {"xyz", "xy", "-xz", "yz", "xz", "-yz", "-xyz", "-xy"};
@@ -115,7 +219,6 @@ std::vector<bool> oneRun(const int l, const int rounds,
     else if (sweepSchedule == "random")
     {
         randomSchedule = true;
-        sweepIndex = distInt0To7(rnEngine);
     }
     else if (sweepSchedule == "const")
     {
@@ -133,7 +236,33 @@ std::vector<bool> oneRun(const int l, const int rounds,
     {
         throw std::invalid_argument("Invalid sweep schedule.");
     }
-    int numberOfDirections = sweepDirections.size();
+    return sweepDirections;
+}
+
+// Runs a single trial on a code which has already been built, the state of
+// the code (error, syndrome and flip bits) is reset at the start of the trial
+inline std::vector<bool> oneRun(Code &code, runContext &context,
+                                const int l, const int rounds,
+                                const double q,
+                                const int sweepLimit,
+                                const std::string sweepSchedule,
+                                const int timeout,
+                                bool greedy,
+                                bool correlatedErrors,
+                                const int sweepRate)
+{
+    std::vector<bool> success = {false, false};
+    code.reset();
+    code.setSeed(context.seed, 2 * context.trial);
+    context.syndromeWeights.clear();
+    context.readoutSweeps = timeout;
+    bool randomSchedule;
+    const vstr sweepDirections = scheduleDirections(sweepSchedule, randomSchedule);
+    int sweepIndex = randomSchedule ? context.distInt0To7(context.scheduleEngine) : 0;
+    int sweepCount = 0;
+    // Convert once so the sweeps below don't parse strings
+    const vdir schedule = toSignedDirections(sweepDirections);
+    int numberOfDirections = schedule.size();
     // std::cerr << "No. of sweep dirs: " << numberOfDirections << std::endl;
     for (int r = 0; r < rounds; ++r)
     {
@@ -141,7 +270,7 @@ std::vector<bool> oneRun(const int l, const int rounds,
         {
             if (randomSchedule)
             {
-                sweepIndex = distInt0To7(rnEngine);
+                sweepIndex = context.distInt0To7(context.scheduleEngine);
             }
             else
             {
@@ -149,24 +278,28 @@ std::vector<bool> oneRun(const int l, const int rounds,
             }
             sweepCount = 0;
         }
-        code->generateDataError(correlatedErrors);
-        code->calculateSyndrome();
+        code.generateDataError(correlatedErrors);
+        code.updateSyndrome();
         if (q > 0)
         {
             // std::cerr << "Generating measurement error." << std::endl;
-            code->generateMeasError();
+            code.generateMeasError();
         }
         for (int i = 0; i < sweepRate; ++i)
         {
-            code->sweep(sweepDirections[sweepIndex], greedy);
+            code.sweep(schedule[sweepIndex], greedy);
+        }
+        if (context.recordSyndromeWeights)
+        {
+            context.syndromeWeights.push_back(code.getUnsatisfiedCount());
         }
         // std::cerr << "direction=" << sweepDirections[sweepIndex] << std::endl;
         // std::cerr << "sweepIndex=" << sweepIndex << std::endl;
         // std::cerr << "sweepCount=" << sweepCount << std::endl;
         ++sweepCount;
     }
-    code->generateDataError(correlatedErrors); // Data errors = measurement errors at readout
-    code->calculateSyndrome();
+    code.generateDataError(correlatedErrors); // Data errors = measurement errors at readout
+    code.updateSyndrome();
     // code.printUnsatisfiedStabilisers();
     for (int r = 0; r < timeout; ++r)
     {
@@ -174,7 +307,7 @@ std::vector<bool> oneRun(const int l, const int rounds,
         {
             if (randomSchedule)
             {
-                sweepIndex = distInt0To7(rnEngine);
+                sweepIndex = context.distInt0To7(context.scheduleEngine);
             }
             else
             {
@@ -182,12 +315,17 @@ std::vector<bool> oneRun(const int l, const int rounds,
             }
             sweepCount = 0;
         }
-        code->sweep(sweepDirections[sweepIndex], greedy);
-        code->calculateSyndrome();
-        if (std::all_of(syndrome.begin(), syndrome.end(), [](int i) { return i == 0; }))
+        code.sweep(schedule[sweepIndex], greedy);
+        // The sweep keeps the syndrome and its count up to date
+        if (context.recordSyndromeWeights)
+        {
+            context.syndromeWeights.push_back(code.getUnsatisfiedCount());
+        }
+        if (code.getUnsatisfiedCount() == 0)
         {
             // std::cout << "Clean Syndrome" << std::endl;
-            success = {code->checkCorrection(), true};
+            success = {code.checkCorrection(), true};
+            context.readoutSweeps = r + 1;
             break;
         }
         // std::cerr << "r=" << r << std::endl;
@@ -204,4 +342,404 @@ std::vector<bool> oneRun(const int l, const int rounds,
     return success;
 }
 
+// Runs trial number trial of a run with the given seed on its own
+inline std::vector<bool> oneRun(const int l, const int rounds,
+                                const double p, const double q,
+                                const int sweepLimit,
+                                const std::string sweepSchedule,
+                                const int timeout,
+                                const std::string latticeType,
+                                bool greedy,
+                                bool correlatedErrors, 
+                                const int sweepRate,
+                                const uint64_t seed,
+                                const uint64_t trial = 0)
+{
+    std::unique_ptr<Code> code = buildCode(l, p, q, latticeType, correlatedErrors, sweepRate);
+    runContext context(seed, trial);
+    return oneRun(*code, context, l, rounds, q, sweepLimit, sweepSchedule, timeout, greedy, correlatedErrors, sweepRate);
+}
+
+// Runs work(i) for i = 0 to threads - 1, on threads of their own when there
+// is more than one, and rethrows the first exception thrown by any of them
+inline void runWorkers(const int threads, const std::function<void(int)> &work)
+{
+    if (threads == 1)
+    {
+        work(0);
+        return;
+    }
+    std::vector<std::exception_ptr> exceptions(threads);
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; ++i)
+    {
+        pool.emplace_back([&, i]() {
+            try
+            {
+                work(i);
+            }
+            catch (...)
+            {
+                exceptions[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto &thread : pool)
+    {
+        thread.join();
+    }
+    for (auto &exception : exceptions)
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+inline trialStatistics summariseTrials(const std::vector<trialResult> &results)
+{
+    trialStatistics statistics = {0, 0, results};
+    for (const auto &result : results)
+    {
+        statistics.successes += result.success;
+        statistics.cleanSyndromes += result.cleanSyndrome;
+    }
+    return statistics;
+}
+
+// Runs many trials in one process, the lattice is built once and only the
+// error and syndrome are reset between trials. With more than one thread each
+// worker decodes on its own clone of the code, clones share the geometry.
+// Trials are numbered from firstTrial, so that runs with the same seed and
+// disjoint trial numbers are independent and can be combined. With
+// recordSyndromeWeights each result also holds the syndrome weights of its trial
+inline trialStatistics runTrials(const int l, const int rounds,
+                                 const double p, const double q,
+                                 const int sweepLimit,
+                                 const std::string sweepSchedule,
+                                 const int timeout,
+                                 const std::string latticeType,
+                                 bool greedy,
+                                 bool correlatedErrors,
+                                 const int sweepRate,
+                                 const int trials,
+                                 int threads,
+                                 const uint64_t seed,
+                                 const uint64_t firstTrial = 0,
+                                 const std::string &geometryCache = "",
+                                 bool recordSyndromeWeights = false)
+{
+    if (threads < 1)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, trials);
+    std::vector<std::unique_ptr<Code>> workerCodes;
+    workerCodes.push_back(buildCode(buildGeometry(l, latticeType, correlatedErrors, geometryCache), p, q, latticeType, sweepRate));
+    for (int i = 1; i < threads; ++i)
+    {
+        workerCodes.push_back(workerCodes[0]->clone());
+    }
+    std::vector<trialResult> results(trials);
+    std::atomic<int> nextTrial(0);
+    runWorkers(threads, [&](const int i) {
+        for (int t = nextTrial++; t < trials; t = nextTrial++)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            runContext context(seed, firstTrial + t);
+            context.recordSyndromeWeights = recordSyndromeWeights;
+            std::vector<bool> succ = oneRun(*workerCodes[i], context, l, rounds, q, sweepLimit, sweepSchedule, timeout, greedy, correlatedErrors, sweepRate);
+            auto finish = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double> elapsed = finish - start;
+            results[t] = {succ[0], succ[1], elapsed.count(), context.readoutSweeps, std::move(context.syndromeWeights)};
+        }
+    });
+    return summariseTrials(results);
+}
+
+// Runs the trials of every point of a grid. One geometry is built for each
+// lattice type, size and error model and kept while points still need it,
+// and the trials of all the points are shared between the threads. The trials
+// are numbered through the whole grid, so no two points share random streams
+// and point i gets the results runTrials gives for it with the same seed and
+// the trials of the points before it as firstTrial. report(i, statistics) is
+// called for point i, in the order of the grid, as soon as its trials and
+// those of the points before it are done.
+inline void runGrid(const std::vector<gridPoint> &points,
+                    int threads,
+                    const uint64_t seed,
+                    const std::function<void(int, const trialStatistics &)> &report,
+                    const std::string &geometryCache = "")
+{
+    struct sharedGeometry
+    {
+        std::once_flag built;
+        std::shared_ptr<const CodeGeometry> geometry;
+        int pointsLeft = 0;
+    };
+    typedef std::tuple<std::string, int, bool> geometryKey;
+    std::map<geometryKey, std::shared_ptr<sharedGeometry>> geometries;
+    // Trial t of point i is item begins[i] + t
+    std::vector<int64_t> begins = {0};
+    for (const auto &point : points)
+    {
+        if (point.trials < 1)
+        {
+            throw std::invalid_argument("Number of trials must be a positive integer.");
+        }
+        auto &shared = geometries[geometryKey(point.latticeType, point.l, point.correlatedErrors)];
+        if (!shared)
+        {
+            shared = std::make_shared<sharedGeometry>();
+        }
+        ++shared->pointsLeft;
+        begins.push_back(begins.back() + point.trials);
+    }
+    if (threads < 1)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::max<int64_t>(1, std::min<int64_t>(threads, begins.back()));
+    std::vector<std::vector<trialResult>> results(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        results[i].resize(points[i].trials);
+    }
+    std::vector<int> trialsDone(points.size(), 0);
+    size_t nextReport = 0;
+    std::mutex mutex;
+    std::atomic<int64_t> nextItem(0);
+    runWorkers(threads, [&](const int) {
+        int current = -1;
+        std::shared_ptr<sharedGeometry> shared;
+        std::unique_ptr<Code> code;
+        for (int64_t item = nextItem++; item < begins.back(); item = nextItem++)
+        {
+            const int i = std::upper_bound(begins.begin(), begins.end(), item) - begins.begin() - 1;
+            const gridPoint &point = points[i];
+            if (i != current)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    shared = geometries.at(geometryKey(point.latticeType, point.l, point.correlatedErrors));
+                }
+                std::call_once(shared->built, [&]() {
+                    shared->geometry = buildGeometry(point.l, point.latticeType, point.correlatedErrors, geometryCache);
+                });
+                code = buildCode(shared->geometry, point.p, point.q, point.latticeType, point.sweepRate);
+                current = i;
+            }
+            const int t = item - begins[i];
+            auto start = std::chrono::high_resolution_clock::now();
+            runContext context(seed, item);
+            std::vector<bool> succ = oneRun(*code, context, point.l, point.rounds, point.q, point.sweepLimit, point.sweepSchedule, point.timeout, point.greedy, point.correlatedErrors, point.sweepRate);
+            auto finish = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double> elapsed = finish - start;
+            results[i][t] = {succ[0], succ[1], elapsed.count(), context.readoutSweeps};
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++trialsDone[i] < point.trials)
+            {
+                continue;
+            }
+            // The geometry is freed once no point needs it and no worker holds it
+            if (--shared->pointsLeft == 0)
+            {
+                geometries.erase(geometryKey(point.latticeType, point.l, point.correlatedErrors));
+            }
+            for (; nextReport < points.size() && trialsDone[nextReport] == points[nextReport].trials; ++nextReport)
+            {
+                report(nextReport, summariseTrials(results[nextReport]));
+                results[nextReport].clear();
+            }
+        }
+    });
+}
+
+// Bit-sliced trial t draws from the streams of scalar trial
+// bitSlicedTrialOffset + t, so bit-sliced and scalar runs with the same
+// seed never share random numbers
+const uint64_t bitSlicedTrialOffset = uint64_t(1) << 61;
+
+// Runs the trials of one batch on the lanes of a bit-sliced code, with the
+// same rounds and readout as oneRun. Lane i is the trial of contexts[i]: it
+// draws its random sweep schedule from its own context, and the errors of
+// every lane come from the error stream of contexts[0]. Only the lanes in
+// lanesInUse are reported, their results go to laneResults (one per lane,
+// with no times).
+inline void oneBitSlicedRun(BitSlicedCode &code, std::vector<runContext> &contexts,
+                            std::vector<trialResult> &laneResults,
+                            const uint64_t lanesInUse,
+                            const int l, const int rounds,
+                            const double q,
+                            const int sweepLimit,
+                            const std::string sweepSchedule,
+                            const int timeout,
+                            bool greedy,
+                            bool correlatedErrors,
+                            const int sweepRate)
+{
+    code.reset();
+    code.setSeed(contexts[0].seed, 2 * contexts[0].trial);
+    bool randomSchedule;
+    const vdir schedule = toSignedDirections(scheduleDirections(sweepSchedule, randomSchedule));
+    const int numberOfDirections = schedule.size();
+    // Lanes sweeping in each direction of the schedule. A fixed schedule
+    // keeps every lane on the same direction, a random one draws a
+    // direction for each lane in use
+    std::vector<uint64_t> directionLanes(numberOfDirections, 0);
+    int sweepIndex = 0;
+    auto drawDirections = [&]() {
+        std::fill(directionLanes.begin(), directionLanes.end(), 0);
+        for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+        {
+            if ((lanesInUse >> lane) & 1)
+            {
+                runContext &context = contexts[lane];
+                directionLanes[context.distInt0To7(context.scheduleEngine)] |= uint64_t(1) << lane;
+            }
+        }
+    };
+    if (randomSchedule)
+    {
+        drawDirections();
+    }
+    else
+    {
+        directionLanes[sweepIndex] = lanesInUse;
+    }
+    int sweepCount = 0;
+    auto nextDirection = [&]() {
+        if (randomSchedule)
+        {
+            drawDirections();
+        }
+        else
+        {
+            directionLanes[sweepIndex] = 0;
+            sweepIndex = (sweepIndex + 1) % numberOfDirections;
+            directionLanes[sweepIndex] = lanesInUse;
+        }
+        sweepCount = 0;
+    };
+    auto sweepLanes = [&]() {
+        for (int d = 0; d < numberOfDirections; ++d)
+        {
+            if (directionLanes[d] != 0)
+            {
+                code.sweep(schedule[d], greedy, directionLanes[d]);
+            }
+        }
+    };
+    for (int r = 0; r < rounds; ++r)
+    {
+        if (sweepCount == sweepLimit)
+        {
+            nextDirection();
+        }
+        code.generateDataError(correlatedErrors);
+        code.updateSyndrome();
+        if (q > 0)
+        {
+            code.generateMeasError();
+        }
+        for (int i = 0; i < sweepRate; ++i)
+        {
+            sweepLanes();
+        }
+        ++sweepCount;
+    }
+    code.generateDataError(correlatedErrors); // Data errors = measurement errors at readout
+    code.updateSyndrome();
+    laneResults.assign(BitSlicedCode::numberOfLanes, {false, false, 0, timeout});
+    // A lane with a clean syndrome is not changed by later sweeps, so its
+    // correction can be checked at the end
+    uint64_t clean = ~lanesInUse;
+    for (int r = 0; r < timeout && ~clean != 0; ++r)
+    {
+        if (sweepCount == l)
+        {
+            nextDirection();
+        }
+        sweepLanes();
+        const uint64_t newlyClean = ~code.unsatisfiedLanes() & ~clean;
+        for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+        {
+            if ((newlyClean >> lane) & 1)
+            {
+                laneResults[lane].cleanSyndrome = true;
+                laneResults[lane].readoutSweeps = r + 1;
+            }
+        }
+        clean |= newlyClean;
+        ++sweepCount;
+    }
+    const uint64_t corrected = code.correctedLanes();
+    for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+    {
+        laneResults[lane].success = laneResults[lane].cleanSyndrome && ((corrected >> lane) & 1);
+    }
+}
+
+// Runs trials 64 at a time on a BitSlicedCode, trial t being lane t % 64 of
+// batch t / 64. Every lane is an independent trial with its own random sweep
+// schedule, see oneBitSlicedRun and bitSlicedTrialOffset for its streams.
+// The time of each trial is its share of the time of its batch.
+inline trialStatistics runBitSlicedTrials(const int l, const int rounds,
+                                          const double p, const double q,
+                                          const int sweepLimit,
+                                          const std::string sweepSchedule,
+                                          const int timeout,
+                                          const std::string latticeType,
+                                          bool greedy,
+                                          bool correlatedErrors,
+                                          const int sweepRate,
+                                          const int trials,
+                                          int threads,
+                                          const uint64_t seed,
+                                          const uint64_t firstTrial = 0,
+                                          const std::string &geometryCache = "")
+{
+    const int lanes = BitSlicedCode::numberOfLanes;
+    if (firstTrial % lanes != 0)
+    {
+        throw std::invalid_argument("The first trial of a bit-sliced run must be a multiple of 64.");
+    }
+    const int batches = (trials + lanes - 1) / lanes;
+    if (threads < 1)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, batches);
+    auto geometry = buildGeometry(l, latticeType, correlatedErrors, geometryCache);
+    std::vector<trialResult> results(trials);
+    std::atomic<int> nextBatch(0);
+    runWorkers(threads, [&](const int) {
+        BitSlicedCode code(geometry, p, q);
+        std::vector<trialResult> laneResults;
+        std::vector<runContext> contexts;
+        for (int b = nextBatch++; b < batches; b = nextBatch++)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            contexts.clear();
+            for (int lane = 0; lane < lanes; ++lane)
+            {
+                contexts.emplace_back(seed, bitSlicedTrialOffset + firstTrial + lanes * b + lane);
+            }
+            const int batchTrials = std::min(lanes, trials - lanes * b);
+            const uint64_t lanesInUse = batchTrials == lanes ? ~uint64_t(0) : (uint64_t(1) << batchTrials) - 1;
+            oneBitSlicedRun(code, contexts, laneResults, lanesInUse, l, rounds, q, sweepLimit, sweepSchedule, timeout, greedy, correlatedErrors, sweepRate);
+            auto finish = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double> elapsed = finish - start;
+            for (int lane = 0; lane < batchTrials; ++lane)
+            {
+                results[lanes * b + lane] = laneResults[lane];
+                results[lanes * b + lane].time = elapsed.count() / batchTrials;
+            }
+        }
+    });
+    return summariseTrials(results);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+#ifndef FLAT_LISTS_H
+#define FLAT_LISTS_H
+
+#include "tableArray.h"
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+// A list of lists stored back to back in one array. Lists of a fixed width
+// need no offsets, otherwise list i is values[offsets[i]] to values[offsets[i + 1]].
+template <typename T>
+class FlatLists
+{
+public:
+  // Read-only view of one list
+  class List
+  {
+  public:
+    typedef const T *iterator;
+    typedef const T *const_iterator;
+    typedef T value_type;
+
+    List(const T *first, const T *last) : first(first), last(last) {}
+    const T *begin() const { return first; }
+    const T *end() const { return last; }
+    int size() const { return last - first; }
+    bool empty() const { return first == last; }
+    const T &operator[](const int i) const { return first[i]; }
+    operator std::vector<T>() const { return std::vector<T>(first, last); }
+
+    friend bool operator==(const List &lhs, const std::vector<T> &rhs)
+    {
+      return lhs.size() == static_cast<int>(rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+    friend bool operator==(const std::vector<T> &lhs, const List &rhs) { return rhs == lhs; }
+
+  private:
+    const T *first;
+    const T *last;
+  };
+
+  class const_iterator
+  {
+  public:
+    const_iterator(const FlatLists *lists, const int i) : lists(lists), i(i) {}
+    const List operator*() const { return (*lists)[i]; }
+    const_iterator &operator++()
+    {
+      ++i;
+      return *this;
+    }
+    bool operator==(const const_iterator &other) const { return i == other.i; }
+    bool operator!=(const const_iterator &other) const { return i != other.i; }
+
+  private:
+    const FlatLists *lists;
+    int i;
+  };
+
+  explicit FlatLists(const int width = 0) : width(width), offsets(width == 0 ? 1 : 0, 0) {}
+  explicit FlatLists(const std::vector<std::vector<T>> &lists, const int width = 0) : FlatLists(width)
+  {
+    for (const auto &list : lists)
+    {
+      push_back(list);
+    }
+  }
+
+  void push_back(const std::vector<T> &list)
+  {
+    if (width == 0)
+    {
+      values.append(list.begin(), list.end());
+      offsets.push_back(values.size());
+    }
+    else if (static_cast<int>(list.size()) == width)
+    {
+      values.append(list.begin(), list.end());
+    }
+    else
+    {
+      throw std::invalid_argument("List length must be equal to the width.");
+    }
+  }
+  void reserve(const int numberOfLists)
+  {
+    if (width == 0)
+    {
+      offsets.reserve(numberOfLists + 1);
+    }
+    else
+    {
+      values.reserve(width * numberOfLists);
+    }
+  }
+  int size() const { return width == 0 ? offsets.size() - 1 : values.size() / width; }
+  bool empty() const { return size() == 0; }
+  // Returned const so that it can also be bound to auto &
+  const List operator[](const int i) const
+  {
+    if (width == 0)
+    {
+      return List(values.data() + offsets[i], values.data() + offsets[i + 1]);
+    }
+    return List(values.data() + width * i, values.data() + width * (i + 1));
+  }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size()); }
+  operator std::vector<std::vector<T>>() const
+  {
+    std::vector<std::vector<T>> lists;
+    for (int i = 0; i < size(); ++i)
+    {
+      lists.push_back((*this)[i]);
+    }
+    return lists;
+  }
+  // Passes the arrays to tables(array), see Lattice::transferTables
+  template <typename Tables>
+  void transferTables(Tables &tables)
+  {
+    tables(width);
+    tables(offsets);
+    tables(values);
+  }
+
+private:
+  int width; // 0 for lists of any length
+  TableArray<int> offsets;
+  TableArray<T> values;
+};
+
+#endif
@@ -0,0 +1,145 @@
+#include "geometryCache.h"
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Start of every file, followed by the format version, the rules
+// fingerprint, l and the lattice type
+static const char magic[8] = {'S', 'W', 'E', 'E', 'P', 'G', 'E', 'O'};
+
+// A whole file mapped read-only into memory, empty if it could not be mapped
+class MappedFile
+{
+private:
+    void *address = MAP_FAILED;
+    size_t length = 0;
+
+public:
+    MappedFile(const std::string &path)
+    {
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor == -1)
+        {
+            return;
+        }
+        struct stat status;
+        if (fstat(descriptor, &status) == 0 && status.st_size > 0)
+        {
+            length = status.st_size;
+            address = mmap(nullptr, length, PROT_READ, MAP_SHARED, descriptor, 0);
+        }
+        // The mapping stays valid once the file is closed
+        close(descriptor);
+    }
+    ~MappedFile()
+    {
+        if (address != MAP_FAILED)
+        {
+            munmap(address, length);
+        }
+    }
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool empty() const { return address == MAP_FAILED; }
+    const char *data() const { return static_cast<const char *>(address); }
+    size_t size() const { return length; }
+};
+
+GeometryCache::GeometryCache(const std::string &directory) : directory(directory)
+{
+    if (directory.empty())
+    {
+        throw std::invalid_argument("Geometry cache directory must not be empty.");
+    }
+}
+
+std::string GeometryCache::path(const std::string &latticeType, const int l) const
+{
+    return directory + "/" + latticeType + "_L" + std::to_string(l) + ".geometry";
+}
+
+uint64_t GeometryCache::fingerprint(CodeGeometry &geometry)
+{
+    TableHasher hasher;
+    geometry.transferTables(hasher);
+    return hasher.value();
+}
+
+std::shared_ptr<CodeGeometry> GeometryCache::load(const std::string &latticeType, const int l, std::shared_ptr<Lattice> lattice,
+                                                  const uint64_t rulesFingerprint) const
+{
+    // Shared by the tables which are views of it
+    auto file = std::make_shared<MappedFile>(path(latticeType, l));
+    if (file->empty())
+    {
+        return nullptr;
+    }
+    TableReader reader(file->data(), file->size(), file);
+    char fileMagic[sizeof(magic)];
+    int version = 0;
+    uint64_t fileFingerprint = 0;
+    int fileL = 0;
+    std::vector<char> fileLatticeType;
+    reader(fileMagic);
+    reader(version);
+    reader(fileFingerprint);
+    reader(fileL);
+    reader(fileLatticeType);
+    if (!reader.good() || std::memcmp(fileMagic, magic, sizeof(magic)) != 0 || version != formatVersion ||
+        fileFingerprint != rulesFingerprint || fileL != l ||
+        std::string(fileLatticeType.begin(), fileLatticeType.end()) != latticeType)
+    {
+        return nullptr;
+    }
+    auto geometry = std::make_shared<CodeGeometry>();
+    geometry->lattice = lattice;
+    geometry->transferTables(reader);
+    // The numbering of the vertices and edges is not saved, so a lattice
+    // numbered differently from the one which was saved is rejected
+    if (!reader.good() || !reader.atEnd() || geometry->l != l ||
+        geometry->numberOfEdges != lattice->getNumberOfEdges() ||
+        lattice->getVertexToEdges().size() != lattice->getNumberOfVertices())
+    {
+        return nullptr;
+    }
+    return geometry;
+}
+
+bool GeometryCache::save(const std::string &latticeType, CodeGeometry &geometry, const uint64_t rulesFingerprint) const
+{
+    mkdir(directory.c_str(), 0777);
+    const std::string finalPath = path(latticeType, geometry.l);
+    // Written under a name of its own and then renamed over the final path
+    const std::string temporaryPath = finalPath + "." + std::to_string(getpid()) + "." +
+                                      std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream stream(temporaryPath, std::ios::binary);
+        TableWriter writer(stream);
+        const int version = formatVersion;
+        writer(magic);
+        writer(version);
+        writer(rulesFingerprint);
+        writer(geometry.l);
+        writer(std::vector<char>(latticeType.begin(), latticeType.end()));
+        geometry.transferTables(writer);
+        stream.close();
+        if (!stream)
+        {
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temporaryPath.c_str(), finalPath.c_str()) != 0)
+    {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,234 @@
+#ifndef GEOMETRY_CACHE_H
+#define GEOMETRY_CACHE_H
+
+#include "codeGeometry.h"
+#include "tableArray.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Values of a TableArray start at a multiple of this many bytes from the
+// start of the file, so that they can be viewed where the file is mapped
+static const size_t tableAlignment = 8;
+
+// Writes the tables passed to it to a binary stream, each array as its
+// length followed by its values
+class TableWriter
+{
+private:
+  std::ostream &stream;
+  size_t position = 0;
+
+  void put(const void *bytes, const size_t size)
+  {
+    stream.write(static_cast<const char *>(bytes), size);
+    position += size;
+  }
+
+public:
+  TableWriter(std::ostream &stream) : stream(stream) {}
+
+  template <typename T>
+  void operator()(const T &value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Tables must hold plain values.");
+    put(&value, sizeof(T));
+  }
+  template <typename T>
+  void operator()(const std::vector<T> &values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Tables must hold plain values.");
+    const uint64_t size = values.size();
+    (*this)(size);
+    put(values.data(), sizeof(T) * size);
+  }
+  // The length, zeros up to the alignment and then the values
+  template <typename T>
+  void operator()(const TableArray<T> &values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value && alignof(T) <= tableAlignment, "Tables must hold plain values.");
+    const uint64_t size = values.size();
+    (*this)(size);
+    const char zeros[tableAlignment] = {};
+    put(zeros, (tableAlignment - position % tableAlignment) % tableAlignment);
+    put(values.data(), sizeof(T) * size);
+  }
+};
+
+// Hashes the values of the tables passed to it with 64-bit FNV-1a, one value
+// at a time so that the padding inside a value is never hashed
+class TableHasher
+{
+private:
+  uint64_t hash = 14695981039346656037ull;
+
+  void add(const void *bytes, const size_t size)
+  {
+    for (size_t i = 0; i < size; ++i)
+    {
+      hash = (hash ^ static_cast<const unsigned char *>(bytes)[i]) * 1099511628211ull;
+    }
+  }
+
+public:
+  template <typename T>
+  void operator()(const T &value)
+  {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Structures need an overload which hashes their members.");
+    add(&value, sizeof(T));
+  }
+  void operator()(const faceS &face) { (*this)(face.faceIndex); }
+  void operator()(const EdgeOwner &owner)
+  {
+    (*this)(owner.vertex);
+    (*this)(owner.direction.direction);
+    (*this)(owner.direction.sign);
+  }
+  void operator()(const SweepTable::Decision &decision)
+  {
+    (*this)(decision.options);
+    (*this)(decision.begin);
+  }
+  void operator()(const SweepStencil::Offset &offset)
+  {
+    (*this)(offset.x);
+    (*this)(offset.y);
+    (*this)(offset.z);
+    (*this)(offset.k);
+  }
+  template <typename Array>
+  void array(const Array &values)
+  {
+    (*this)(static_cast<uint64_t>(values.size()));
+    for (const auto &value : values)
+    {
+      (*this)(value);
+    }
+  }
+  template <typename T>
+  void operator()(const std::vector<T> &values) { array(values); }
+  template <typename T>
+  void operator()(const TableArray<T> &values) { array(values); }
+  uint64_t value() const { return hash; }
+};
+
+// Reads back tables written by a TableWriter from memory, in the same order.
+// A read past the end of the data leaves the value unchanged and makes the
+// reader fail, so a short or damaged file is never read beyond its end.
+// With a source which keeps the data alive, the values of each TableArray
+// are viewed in the data instead of copied.
+class TableReader
+{
+private:
+  const char *data;
+  size_t size;
+  std::shared_ptr<const void> source;
+  size_t position = 0;
+  bool failed = false;
+
+  bool take(void *destination, const size_t bytes)
+  {
+    if (failed || bytes > size - position)
+    {
+      failed = true;
+      return false;
+    }
+    std::memcpy(destination, data + position, bytes);
+    position += bytes;
+    return true;
+  }
+
+public:
+  TableReader(const char *data, const size_t size, std::shared_ptr<const void> source = nullptr)
+      : data(data), size(size), source(std::move(source)) {}
+
+  template <typename T>
+  void operator()(T &value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Tables must hold plain values.");
+    take(&value, sizeof(T));
+  }
+  template <typename T>
+  void operator()(std::vector<T> &values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Tables must hold plain values.");
+    uint64_t length = 0;
+    if (!take(&length, sizeof(length)) || length > (size - position) / sizeof(T))
+    {
+      failed = true;
+      return;
+    }
+    values.resize(length);
+    take(values.data(), sizeof(T) * length);
+  }
+  template <typename T>
+  void operator()(TableArray<T> &values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value && alignof(T) <= tableAlignment, "Tables must hold plain values.");
+    uint64_t length = 0;
+    take(&length, sizeof(length));
+    const size_t padding = (tableAlignment - position % tableAlignment) % tableAlignment;
+    if (failed || padding > size - position || length > (size - position - padding) / sizeof(T))
+    {
+      failed = true;
+      return;
+    }
+    position += padding;
+    const char *first = data + position;
+    if (source && reinterpret_cast<uintptr_t>(first) % alignof(T) == 0)
+    {
+      values = TableArray<T>(reinterpret_cast<const T *>(first), length, source);
+      position += sizeof(T) * length;
+    }
+    else
+    {
+      std::vector<T> copy(length);
+      take(copy.data(), sizeof(T) * length);
+      values = TableArray<T>(std::move(copy));
+    }
+  }
+  bool good() const { return !failed; }
+  bool atEnd() const { return position == size; }
+};
+
+// Geometries saved in a directory, one binary file for each lattice type and
+// size, so that a geometry is built by the first run which needs it and read
+// by the others. Loading maps the file read-only, and the FlatLists, face
+// lookup, edge owners and per-vertex sweep tables of the geometry are views
+// of the mapping, so runs on one machine share a single page-cache copy of
+// them. The mapping lives as long as the geometry. The smaller tables are
+// copied. Files are replaced atomically, so runs which save the same
+// geometry at the same time don't see each other's partial files.
+class GeometryCache
+{
+private:
+  std::string directory;
+
+public:
+  // Bumped whenever the tables or their order change, files of other
+  // versions are ignored and rewritten
+  static const int formatVersion = 2;
+  // Size of the geometry whose tables are hashed into the fingerprint
+  static const int fingerprintL = 6;
+
+  GeometryCache(const std::string &directory);
+
+  std::string path(const std::string &latticeType, const int l) const;
+  // A hash of every table of a geometry. Files record the fingerprint of a
+  // geometry of size fingerprintL built by the current rules, so files saved
+  // by rules which build different tables are rebuilt.
+  static uint64_t fingerprint(CodeGeometry &geometry);
+  // The saved geometry of this lattice type and size, with its tables read
+  // into lattice, which must be a newly constructed lattice of that type and
+  // size. nullptr if there is no file of this version and fingerprint.
+  std::shared_ptr<CodeGeometry> load(const std::string &latticeType, const int l, std::shared_ptr<Lattice> lattice,
+                                     const uint64_t rulesFingerprint) const;
+  // Creates the directory if needed, false if the file could not be written
+  bool save(const std::string &latticeType, CodeGeometry &geometry, const uint64_t rulesFingerprint) const;
+};
+
+#endif
@@ -8,7 +8,68 @@
 
 int sgn(int x) { return (x > 0) - (x < 0); }
 
-Lattice::Lattice(const int length) : l(length)
+Direction toDirection(const std::string &name)
+{
+    if (name == "xyz")
+        return Direction::xyz;
+    else if (name == "x")
+        return Direction::x;
+    else if (name == "xy")
+        return Direction::xy;
+    else if (name == "y")
+        return Direction::y;
+    else if (name == "yz")
+        return Direction::yz;
+    else if (name == "z")
+        return Direction::z;
+    else if (name == "xz")
+        return Direction::xz;
+    throw std::invalid_argument("Direction must be one of 'x', 'y', 'z', xy', 'xz', 'yz' or 'xyz'.");
+}
+
+SignedDirection toSignedDirection(const std::string &name)
+{
+    if (!name.empty() && name[0] == '-')
+    {
+        return -toDirection(name.substr(1));
+    }
+    return toDirection(name);
+}
+
+std::string toString(const Direction direction)
+{
+    static const vstr names = {"xyz", "x", "xy", "y", "yz", "z", "xz"};
+    return names[static_cast<int>(direction)];
+}
+
+std::string toString(const SignedDirection &direction)
+{
+    return (direction.sign < 0 ? "-" : "") + toString(direction.direction);
+}
+
+vdir toSignedDirections(const vstr &names)
+{
+    vdir directions;
+    directions.reserve(names.size());
+    for (const auto &name : names)
+    {
+        directions.push_back(toSignedDirection(name));
+    }
+    return directions;
+}
+
+vstr toStrings(const vdir &directions)
+{
+    vstr names;
+    names.reserve(directions.size());
+    for (const auto &direction : directions)
+    {
+        names.push_back(toString(direction));
+    }
+    return names;
+}
+
+Lattice::Lattice(const int length) : l(length), faceToVertices(4), faceToEdges(4), upEdges(14)
 {
     if (length < 3)
     {
@@ -16,70 +77,205 @@ Lattice::Lattice(const int length) : l(length)
     }
 }
 
-cartesian4 Lattice::indexToCoordinate(const int vertexIndex)
+cartesian4 Lattice::indexToCoordinate(const int vertexIndex) const
 {
     if (vertexIndex < 0)
     {
         throw std::invalid_argument("Index must not be negative.");
     }
+    if (vertexIndex >= numberOfVertices)
+    {
+        throw std::invalid_argument("Index must be less than the number of vertices.");
+    }
+    const int site = vertexToSite[vertexIndex];
     cartesian4 coordinate;
-    coordinate.x = vertexIndex % l;
-    coordinate.y = int(floor(vertexIndex / l)) % l;
-    coordinate.z = int(floor(vertexIndex / (l * l))) % l;
+    coordinate.x = site % l;
+    coordinate.y = (site / l) % l;
+    coordinate.z = (site / (l * l)) % l;
     // w is either 0 or 1 and fixes the sub-lattice
-    coordinate.w = int(floor(vertexIndex / (l * l * l)));
+    coordinate.w = site / (l * l * l);
     return coordinate;
 }
 
-int Lattice::coordinateToIndex(const cartesian4 &coordinate)
+int Lattice::coordinateToIndex(const cartesian4 &coordinate) const
 {
     if (coordinate.x < 0 || coordinate.y < 0 || coordinate.z < 0 || coordinate.w < 0 || coordinate.w > 1)
     {
         throw std::invalid_argument("Lattice coordinates must be positive and w coordinate must be either zero or one.");
     }
-    return coordinate.w * l * l * l + coordinate.z * l * l + coordinate.y * l + coordinate.x;
+    if (coordinate.x >= l || coordinate.y >= l || coordinate.z >= l)
+    {
+        throw std::invalid_argument("Lattice coordinates must be less than l.");
+    }
+    const int site = coordinate.x + l * (coordinate.y + l * (coordinate.z + l * coordinate.w));
+    return site < static_cast<int>(siteToVertex.size()) ? siteToVertex[site] : -1;
+}
+
+void Lattice::numberVertices(const int numberOfSubLattices, const int w0Parity)
+{
+    const int numberOfSites = numberOfSubLattices * l * l * l;
+    siteToVertex.assign(numberOfSites, -1);
+    vertexToSite.clear();
+    numberOfW0Vertices = 0;
+    for (int site = 0; site < numberOfSites; ++site)
+    {
+        const bool w0 = site < l * l * l;
+        const int parity = (site % l + (site / l) % l + (site / (l * l)) % l) % 2;
+        if (w0 && w0Parity != -1 && parity != w0Parity)
+        {
+            continue;
+        }
+        siteToVertex[site] = vertexToSite.size();
+        vertexToSite.push_back(site);
+        numberOfW0Vertices += w0;
+    }
+    numberOfVertices = vertexToSite.size();
 }
 
-int Lattice::edgeIndex(const int vertexIndex, const std::string &direction, const int sign)
+void Lattice::createNeighbours(const std::vector<Direction> &directions)
+{
+    neighbours.assign(14 * numberOfVertices, -1);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex)
+    {
+        for (const auto direction : directions)
+        {
+            for (const int sign : {1, -1})
+            {
+                SignedDirection signedDirection(direction, sign);
+                neighbours[14 * vertexIndex + signedDirection.index()] = computeNeighbour(vertexIndex, direction, sign);
+            }
+        }
+    }
+}
+
+int Lattice::neighbour(const int vertexIndex, const Direction direction, const int sign) const
 {
     if (!(sign == 1 || sign == -1))
     {
         throw std::invalid_argument("Sign must be either 1 or -1.");
     }
-    if (!(direction == "x" || direction == "y" || direction == "z" || direction == "xy" || direction == "xz" || direction == "yz" ||
-          direction == "xyz"))
+    int neighbourIndex = computeNeighbour(vertexIndex, direction, sign);
+    if (neighbourIndex == -1)
+    {
+        std::ostringstream stream;
+        stream << "Lattice::neighbour, " << (sign > 0 ? "+" : "-") << toString(direction) << " neighbour of " << indexToCoordinate(vertexIndex) << " is outside the lattice.";
+        throw std::invalid_argument(stream.str());
+    }
+    return neighbourIndex;
+}
+
+int Lattice::findEdge(const int vertexIndex, const SignedDirection &direction) const
+{
+    int neighbourIndex = findNeighbour(vertexIndex, direction);
+    if (neighbourIndex == -1)
+    {
+        return -1;
+    }
+    return ownedEdge(findOwner(vertexIndex, direction, neighbourIndex));
+}
+
+EdgeOwner Lattice::findOwner(const int vertexIndex, const SignedDirection &direction, const int neighbourIndex) const
+{
+    const bool w0 = vertexIndex < numberOfW0Vertices;
+    const bool ownedHere = w0 == (neighbourIndex < numberOfW0Vertices) ? direction.sign > 0 : w0;
+    if (ownedHere)
+    {
+        return {vertexIndex, direction};
+    }
+    return {neighbourIndex, -direction};
+}
+
+void Lattice::numberEdges(const vdir &ownerDirections)
+{
+    edgesPerOwner = ownerDirections.size();
+    ownerSlots.assign(14, -1);
+    for (int i = 0; i < edgesPerOwner; ++i)
     {
-        throw std::invalid_argument("Direction must be one of 'x', 'y', 'z', xy', 'xz', 'yz' or 'xyz'.");
+        ownerSlots[ownerDirections[i].index()] = i;
     }
+    numberOfEdges = edgesPerOwner * numberOfW0Vertices;
+}
 
-    int edgeIndex;
-    if (sign < 0)
+void Lattice::indexEdges()
+{
+    edgeOwners.assign(numberOfEdges, {-1, SignedDirection()});
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex)
     {
-        edgeIndex = neighbour(vertexIndex, direction, sign);
+        auto edges = vertexToEdges[vertexIndex];
+        for (int i = 0; i < 14; ++i)
+        {
+            SignedDirection direction(static_cast<Direction>(i % 7), i < 7 ? 1 : -1);
+            const int neighbourIndex = findNeighbour(vertexIndex, direction);
+            if (neighbourIndex == -1)
+            {
+                continue;
+            }
+            const EdgeOwner owner = findOwner(vertexIndex, direction, neighbourIndex);
+            const int edge = ownedEdge(owner);
+            if (std::find(edges.begin(), edges.end(), edge) == edges.end())
+            {
+                continue;
+            }
+            EdgeOwner &recorded = edgeOwners[edge];
+            if (recorded.vertex != -1 && (recorded.vertex != owner.vertex || recorded.direction != owner.direction))
+            {
+                throw std::logic_error("Two edges of the lattice have the same index.");
+            }
+            recorded = owner;
+        }
     }
-    else
+}
+
+SignedDirection Lattice::edgeDirection(const int edgeIndex, const int vertexIndex) const
+{
+    const EdgeOwner &owner = edgeOwners[edgeIndex];
+    if (owner.vertex == vertexIndex)
+    {
+        return owner.direction;
+    }
+    if (owner.vertex == -1 || findNeighbour(owner.vertex, owner.direction) != vertexIndex)
     {
-        // Check that 2nd vertex is not outside the lattice, exception will be thrown if this is the case
-        int testIndex = neighbour(vertexIndex, direction, sign);
-        // Otherwise do this
-        edgeIndex = vertexIndex;
+        throw std::invalid_argument("Vertex is not an end of the edge.");
     }
-    // Numbering is an arbitrary convention
-    if (direction == "xyz")
-        edgeIndex = 7 * edgeIndex;
-    else if (direction == "x")
-        edgeIndex = 7 * edgeIndex + 1;
-    else if (direction == "xy")
-        edgeIndex = 7 * edgeIndex + 2;
-    else if (direction == "y")
-        edgeIndex = 7 * edgeIndex + 3;
-    else if (direction == "yz")
-        edgeIndex = 7 * edgeIndex + 4;
-    else if (direction == "z")
-        edgeIndex = 7 * edgeIndex + 5;
-    else if (direction == "xz")
-        edgeIndex = 7 * edgeIndex + 6;
-    return edgeIndex;
+    return -owner.direction;
+}
+
+void Lattice::addEdge(vint &edges, const int vertexIndex, const SignedDirection &direction) const
+{
+    int edge = findEdge(vertexIndex, direction);
+    if (edge != -1)
+    {
+        edges.push_back(edge);
+    }
+}
+
+int Lattice::edgeIndex(const int vertexIndex, const Direction direction, const int sign) const
+{
+    if (!(sign == 1 || sign == -1))
+    {
+        throw std::invalid_argument("Sign must be either 1 or -1.");
+    }
+    // Throws if the 2nd vertex is outside the lattice
+    int neighbourIndex = neighbour(vertexIndex, direction, sign);
+    return ownedEdge(findOwner(vertexIndex, SignedDirection(direction, sign), neighbourIndex));
+}
+
+int Lattice::edgeIndex(const int vertexIndex, const std::string &direction, const int sign) const
+{
+    if (!(sign == 1 || sign == -1))
+    {
+        throw std::invalid_argument("Sign must be either 1 or -1.");
+    }
+    return edgeIndex(vertexIndex, toDirection(direction), sign);
+}
+
+int Lattice::neighbour(const int vertexIndex, const std::string &direction, const int sign) const
+{
+    if (!(sign == 1 || sign == -1))
+    {
+        throw std::invalid_argument("Sign must be either 1 or -1.");
+    }
+    return neighbour(vertexIndex, toDirection(direction), sign);
 }
 
 void Lattice::addFace(const int vertexIndex, const int faceIndex, const vstr &directions, const vint &signs)
@@ -95,20 +291,55 @@ void Lattice::addFace(const int vertexIndex, const int faceIndex, const vstr &di
              edgeIndex(neighbourVertex, directions[2], signs[2]),
              edgeIndex(vertices[2], directions[3], signs[3])};
 
-    faceS face;
     std::sort(vertices.begin(), vertices.end());
     std::sort(edges.begin(), edges.end());
-    face.vertices = vertices;
-    face.faceIndex = faceIndex;
     faceToVertices.push_back(vertices);
     faceToEdges.push_back(edges);
-    for (const auto &vertex : vertices)
+}
+
+// Hash of four sorted vertex indices
+static inline uint64_t faceHash(const std::array<int, 4> &vertices)
+{
+    uint64_t hash = 0;
+    for (const int vertex : vertices)
+    {
+        hash = (hash ^ static_cast<uint64_t>(vertex)) * 0x9E3779B97F4A7C15ULL;
+    }
+    return hash ^ (hash >> 32);
+}
+
+void Lattice::indexFaces()
+{
+    // Faces of each vertex in the order they were added
+    std::vector<std::vector<faceS>> faces(numberOfVertices);
+    for (int faceIndex = 0; faceIndex < faceToVertices.size(); ++faceIndex)
+    {
+        for (const int vertex : faceToVertices[faceIndex])
+        {
+            faces[vertex].push_back({faceIndex});
+        }
+    }
+    vertexToFaces = FlatLists<faceS>(faces);
+    // Open addressing with linear probing, at most half full
+    int tableSize = 1;
+    while (tableSize < 2 * faceToVertices.size())
+    {
+        tableSize *= 2;
+    }
+    faceLookup.assign(tableSize, -1);
+    for (int faceIndex = 0; faceIndex < faceToVertices.size(); ++faceIndex)
     {
-        vertexToFaces[vertex].push_back(face);
+        auto vertices = faceToVertices[faceIndex];
+        uint64_t slot = faceHash({vertices[0], vertices[1], vertices[2], vertices[3]});
+        while (faceLookup[slot & (tableSize - 1)] != -1)
+        {
+            ++slot;
+        }
+        faceLookup[slot & (tableSize - 1)] = faceIndex;
     }
 }
 
-int Lattice::findFace(vint &vertices)
+int Lattice::findFace(vint &vertices) const
 {
     if (vertices.size() != 4)
     {
@@ -119,13 +350,10 @@ int Lattice::findFace(vint &vertices)
         throw std::invalid_argument("Lattice::findFace, vertex indices cannot be negative.");
     }
     std::sort(vertices.begin(), vertices.end());
-    auto v0Faces = vertexToFaces[vertices[0]];
-    for (const auto &face : v0Faces)
+    int faceIndex = lookupFace({vertices[0], vertices[1], vertices[2], vertices[3]});
+    if (faceIndex != -1)
     {
-        if (face.vertices == vertices)
-        {
-            return face.faceIndex;
-        }
+        return faceIndex;
     }
     std::ostringstream stream;
     stream << "Lattice::findFace, no face found for vertices " << indexToCoordinate(vertices[0]) << ", " << indexToCoordinate(vertices[1]) << ", " << indexToCoordinate(vertices[2]) << ", " << indexToCoordinate(vertices[3]);
@@ -133,27 +361,77 @@ int Lattice::findFace(vint &vertices)
     throw std::invalid_argument(errorMessage);
 }
 
-const vvint &Lattice::getFaceToVertices() const
+int Lattice::lookupFace(std::array<int, 4> vertices) const
+{
+    std::sort(vertices.begin(), vertices.end());
+    const uint64_t mask = faceLookup.size() - 1;
+    for (uint64_t slot = faceHash(vertices); faceLookup[slot & mask] != -1; ++slot)
+    {
+        const int faceIndex = faceLookup[slot & mask];
+        auto faceVertices = faceToVertices[faceIndex];
+        if (std::equal(faceVertices.begin(), faceVertices.end(), vertices.begin()))
+        {
+            return faceIndex;
+        }
+    }
+    return -1;
+}
+
+const FlatLists<int> &Lattice::getFaceToVertices() const
 {
     return faceToVertices;
 }
 
-const vvint &Lattice::getFaceToEdges() const
+const FlatLists<int> &Lattice::getFaceToEdges() const
 {
     return faceToEdges;
 }
 
-const std::vector<std::vector<faceS>> &Lattice::getVertexToFaces() const
+const FlatLists<faceS> &Lattice::getVertexToFaces() const
 {
     return vertexToFaces;
 }
 
-std::map<std::string, vvint> &Lattice::getUpEdgesMap()
+void Lattice::addUpEdges(const std::string &direction, const vvint &vertexToUpEdges)
+{
+    upEdges[toSignedDirection(direction).index()] = FlatLists<int>(vertexToUpEdges);
+}
+
+std::map<std::string, vvint> Lattice::getUpEdgesMap() const
 {
+    std::map<std::string, vvint> upEdgesMap;
+    for (int i = 0; i < 14; ++i)
+    {
+        if (!upEdges[i].empty())
+        {
+            SignedDirection direction(static_cast<Direction>(i % 7), i < 7 ? 1 : -1);
+            upEdgesMap[toString(direction)] = upEdges[i];
+        }
+    }
     return upEdgesMap;
 }
 
-const vvint &Lattice::getVertexToEdges() const
+const FlatLists<int> &Lattice::getVertexToEdges() const
 {
     return vertexToEdges;
+}
+
+int Lattice::getNumberOfVertices() const
+{
+    return numberOfVertices;
+}
+
+int Lattice::getNumberOfW0Vertices() const
+{
+    return numberOfW0Vertices;
+}
+
+int Lattice::getNumberOfEdges() const
+{
+    return numberOfEdges;
+}
+
+int Lattice::getEdgesPerOwner() const
+{
+    return edgesPerOwner;
 }
\ No newline at end of file
@@ -5,6 +5,9 @@
 #include <string>
 #include <map>
 #include <iostream>
+#include <cstdint>
+#include <array>
+#include "flatLists.h"
 
 typedef std::vector<int> vint;
 typedef std::vector<double> vdbl;
@@ -23,7 +26,6 @@ struct cartesian4
 
 struct faceS
 {
-  vint vertices;
   int faceIndex;
 };
 
@@ -44,42 +46,168 @@ inline std::ostream &operator<<(std::ostream &o, const cartesian4 &c)
 // Sign of a number, +1, 0 or -1
 int sgn(int x);
 
+// Lattice directions
+enum class Direction : int8_t
+{
+  xyz = 0,
+  x = 1,
+  xy = 2,
+  y = 3,
+  yz = 4,
+  z = 5,
+  xz = 6
+};
+
+// A direction and a sign, e.g. -xy is {Direction::xy, -1} or -Direction::xy
+struct SignedDirection
+{
+  Direction direction;
+  int sign;
+
+  constexpr SignedDirection(const Direction direction = Direction::xyz, const int sign = 1) : direction(direction), sign(sign) {}
+  // Position in tables with one entry per signed direction, 0 to 13
+  constexpr int index() const { return static_cast<int>(direction) + 7 * (sign < 0); }
+};
+
+typedef std::vector<SignedDirection> vdir;
+
+// The vertex an edge is numbered from and the direction of the edge from it
+struct EdgeOwner
+{
+  int vertex; // -1 for edge indices which are not edges
+  SignedDirection direction;
+};
+
+constexpr bool operator==(const SignedDirection &lhs, const SignedDirection &rhs)
+{
+  return lhs.direction == rhs.direction && lhs.sign == rhs.sign;
+}
+
+constexpr bool operator!=(const SignedDirection &lhs, const SignedDirection &rhs)
+{
+  return !(lhs == rhs);
+}
+
+constexpr SignedDirection operator-(const Direction direction)
+{
+  return SignedDirection(direction, -1);
+}
+
+constexpr SignedDirection operator-(const SignedDirection &direction)
+{
+  return SignedDirection(direction.direction, -direction.sign);
+}
+
+// Conversions from and to names like "xy" or "-xyz", invalid names throw
+Direction toDirection(const std::string &name);
+SignedDirection toSignedDirection(const std::string &name);
+std::string toString(const Direction direction);
+std::string toString(const SignedDirection &direction);
+vdir toSignedDirections(const vstr &names);
+vstr toStrings(const vdir &directions);
+
 class Lattice
 {
 protected:
   const int l;
-  vvint faceToVertices;
-  vvint faceToEdges;
-  std::vector<std::vector<faceS>> vertexToFaces;
-  std::map<std::string, vvint> upEdgesMap;
-  vvint vertexToEdges;
+  int numberOfVertices;
+  int numberOfW0Vertices; // the vertices of the w = 0 sub-lattice come first
+  vint siteToVertex; // vertex index of site x + l * (y + l * (z + l * w)), -1 if it has no vertex
+  vint vertexToSite;
+  FlatLists<int> faceToVertices; // four per face
+  FlatLists<int> faceToEdges; // four per face
+  FlatLists<faceS> vertexToFaces;
+  std::vector<FlatLists<int>> upEdges; // indexed by signed direction then vertex
+  FlatLists<int> vertexToEdges;
+  TableArray<int> faceLookup; // hash table of faces by their sorted vertices, -1 if empty
+  vint neighbours; // by vertex then signed direction index, -1 outside the lattice
+  // Only edges are numbered: each belongs to its end on the w = 0 sub-lattice
+  // (its lower end if both are), which numbers edgesPerOwner of them, one for
+  // each owner direction
+  int numberOfEdges = 0;
+  int edgesPerOwner = 0;
+  vint ownerSlots; // position of each signed direction among the owner directions, -1 if absent
+  TableArray<EdgeOwner> edgeOwners; // of each edge index, to decode it
   Lattice(const int l);
   Lattice();
+  // Number the sites of the sub-lattices which hold a vertex in order, where
+  // w = 0 sites only do if x + y + z has w0Parity (-1 for every site)
+  void numberVertices(const int numberOfSubLattices, const int w0Parity);
+  void createNeighbours(const std::vector<Direction> &directions);
+  // Set up the edge numbering after createNeighbours
+  void numberEdges(const vdir &ownerDirections);
+  EdgeOwner findOwner(const int vertexIndex, const SignedDirection &direction, const int neighbourIndex) const;
+  int ownedEdge(const EdgeOwner &owner) const { return edgesPerOwner * owner.vertex + ownerSlots[owner.direction.index()]; }
+  // Owner table built from vertexToEdges once it is created
+  void indexEdges();
+  void addEdge(vint &edges, const int vertexIndex, const SignedDirection &direction) const;
+  // Face tables built from faceToVertices once all faces are added
+  void indexFaces();
   void addFace(const int vertexIndex, const int faceIndex, const vstr &directions, const vint &signs);
+  void addUpEdges(const std::string &direction, const vvint &vertexToUpEdges);
 
 public:
   virtual ~Lattice() = default;
 
-  cartesian4 indexToCoordinate(const int vertexIndex);
-  int coordinateToIndex(const cartesian4 &coordinate);
-  int findFace(vint &vertices);
+  cartesian4 indexToCoordinate(const int vertexIndex) const;
+  // Index of the vertex at a coordinate, -1 if the lattice has no vertex there
+  int coordinateToIndex(const cartesian4 &coordinate) const;
+  int findFace(vint &vertices) const;
   // Find the edge pointing in the sign direction which
   // contains a vertex (index)
-  virtual int edgeIndex(const int vertexIndex, const std::string &direction, const int sign);
+  int edgeIndex(const int vertexIndex, const Direction direction, const int sign) const;
+  int edgeIndex(const int vertexIndex, const std::string &direction, const int sign) const;
+  // Find neighbour of a vertex (index) in the sign direction,
+  // throws if it is outside the lattice
+  int neighbour(const int vertexIndex, const Direction direction, const int sign) const;
+  int neighbour(const int vertexIndex, const std::string &direction, const int sign) const;
+  // Precomputed neighbour and edge of a vertex, -1 if outside the lattice
+  int findNeighbour(const int vertexIndex, const SignedDirection &direction) const { return neighbours[14 * vertexIndex + direction.index()]; }
+  int findEdge(const int vertexIndex, const SignedDirection &direction) const;
+  // Index of the face with these vertices (in any order), -1 if there is none
+  int lookupFace(std::array<int, 4> vertices) const;
   
   // Pure virtual methods
-  // Find neighbour of a vertex (index) in the sign direction
-  virtual int neighbour(const int vertexIndex, const std::string &direction, const int sign) = 0;
+  // Neighbour of a vertex, or -1 if it is outside the lattice
+  virtual int computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const = 0;
   virtual void createFaces() = 0;
   virtual void createVertexToEdges() = 0;
   virtual void createUpEdgesMap() = 0;
   
   // Getter methods
-  std::map<std::string, vvint> &getUpEdgesMap();
-  const vvint &getFaceToVertices() const;
-  const vvint &getFaceToEdges() const;
-  const std::vector<std::vector<faceS>> &getVertexToFaces() const;
-  const vvint &getVertexToEdges() const;
+  std::map<std::string, vvint> getUpEdgesMap() const;
+  // Edges of a vertex which point up in the sweep direction
+  const FlatLists<int>::List getUpEdges(const int vertexIndex, const SignedDirection &direction) const { return upEdges[direction.index()][vertexIndex]; }
+  const FlatLists<int> &getFaceToVertices() const;
+  const FlatLists<int> &getFaceToEdges() const;
+  const FlatLists<faceS> &getVertexToFaces() const;
+  const FlatLists<int> &getVertexToEdges() const;
+  int getNumberOfVertices() const;
+  int getNumberOfW0Vertices() const;
+  int getNumberOfEdges() const;
+  int getEdgesPerOwner() const;
+  const EdgeOwner &getEdgeOwner(const int edgeIndex) const { return edgeOwners[edgeIndex]; }
+  // Direction of an edge from one of its ends
+  SignedDirection edgeDirection(const int edgeIndex, const int vertexIndex) const;
+
+  // Passes the tables built by createFaces, createUpEdgesMap and
+  // createVertexToEdges to tables(value) one at a time, always in the same
+  // order, so that a GeometryCache can write them to a file and read them
+  // back into a lattice of the same type and size
+  template <typename Tables>
+  void transferTables(Tables &tables)
+  {
+    faceToVertices.transferTables(tables);
+    faceToEdges.transferTables(tables);
+    vertexToFaces.transferTables(tables);
+    for (auto &lists : upEdges)
+    {
+      lists.transferTables(tables);
+    }
+    vertexToEdges.transferTables(tables);
+    tables(faceLookup);
+    tables(edgeOwners);
+  }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include "parameterGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+// Every column a grid may have, in the order they are written
+static const std::vector<std::string> columnNames = {
+    "L", "p", "q", "cycles", "trials", "lattice_type", "sweep_limit", "sweep_schedule",
+    "timeout", "greedy", "correlated_errors", "sweep_rate", "job_number"};
+static const std::vector<std::string> requiredColumns = {"L", "p", "cycles", "trials"};
+
+template <typename T>
+static T parseValue(const std::string &column, const std::string &value)
+{
+    std::istringstream stream(value);
+    T parsed;
+    if (!(stream >> std::boolalpha >> parsed) || !(stream >> std::ws).eof())
+    {
+        throw std::invalid_argument("Invalid value " + value + " in column " + column + " of the parameter grid.");
+    }
+    return parsed;
+}
+
+static std::vector<std::string> splitLine(const std::string &line)
+{
+    std::vector<std::string> cells;
+    std::istringstream stream(line);
+    std::string cell;
+    while (std::getline(stream, cell, ','))
+    {
+        cells.push_back(cell);
+    }
+    if (!line.empty() && line.back() == ',')
+    {
+        cells.push_back("");
+    }
+    return cells;
+}
+
+static std::vector<std::string> splitCell(const std::string &cell)
+{
+    std::vector<std::string> values;
+    std::istringstream stream(cell);
+    std::string value;
+    while (stream >> value)
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+// The point of one combination of values, where values maps each column
+// which has a value to it
+static gridPoint makePoint(const std::map<std::string, std::string> &values)
+{
+    for (const auto &column : requiredColumns)
+    {
+        if (values.count(column) == 0)
+        {
+            throw std::invalid_argument("The parameter grid has no value of " + column + ".");
+        }
+    }
+    auto has = [&](const std::string &column) { return values.count(column) > 0; };
+    gridPoint point;
+    point.l = parseValue<int>("L", values.at("L"));
+    point.p = parseValue<double>("p", values.at("p"));
+    point.q = has("q") ? parseValue<double>("q", values.at("q")) : point.p;
+    point.rounds = parseValue<int>("cycles", values.at("cycles"));
+    point.trials = parseValue<int>("trials", values.at("trials"));
+    if (point.trials < 1)
+    {
+        throw std::invalid_argument("Number of trials must be a positive integer.");
+    }
+    point.latticeType = has("lattice_type") ? values.at("lattice_type") : "rhombic_toric";
+    point.sweepLimit = has("sweep_limit") ? parseValue<int>("sweep_limit", values.at("sweep_limit")) : std::ceil(std::log(point.l));
+    point.sweepSchedule = has("sweep_schedule") ? values.at("sweep_schedule") : "random";
+    point.timeout = has("timeout") ? parseValue<int>("timeout", values.at("timeout")) : 32 * point.l;
+    point.greedy = has("greedy") && parseValue<bool>("greedy", values.at("greedy"));
+    point.correlatedErrors = has("correlated_errors") && parseValue<bool>("correlated_errors", values.at("correlated_errors"));
+    point.sweepRate = has("sweep_rate") ? parseValue<int>("sweep_rate", values.at("sweep_rate")) : 1;
+    point.jobNumber = has("job_number") ? parseValue<int>("job_number", values.at("job_number")) : -1;
+    return point;
+}
+
+ParameterGrid::ParameterGrid(std::istream &input)
+{
+    std::string line;
+    std::vector<std::string> header;
+    while (header.empty() && std::getline(input, line))
+    {
+        line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+        for (const auto &cell : splitLine(line))
+        {
+            const auto names = splitCell(cell);
+            if (names.size() != 1 || std::find(columnNames.begin(), columnNames.end(), names[0]) == columnNames.end())
+            {
+                throw std::invalid_argument("Invalid column " + cell + " of the parameter grid.");
+            }
+            if (std::find(header.begin(), header.end(), names[0]) != header.end())
+            {
+                throw std::invalid_argument("Column " + names[0] + " appears twice in the parameter grid.");
+            }
+            header.push_back(names[0]);
+        }
+    }
+    while (std::getline(input, line))
+    {
+        line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+        const auto cells = splitLine(line);
+        if (splitCell(line).empty())
+        {
+            continue;
+        }
+        if (cells.size() != header.size())
+        {
+            throw std::invalid_argument("Row of the parameter grid with " + std::to_string(cells.size()) +
+                                        " cells instead of " + std::to_string(header.size()) + ".");
+        }
+        std::vector<std::vector<std::string>> columnValues;
+        for (const auto &cell : cells)
+        {
+            columnValues.push_back(splitCell(cell));
+        }
+        // Counts through the combinations with the last column fastest, an
+        // empty cell leaves its column out
+        std::vector<size_t> choice(header.size(), 0);
+        for (bool more = true; more;)
+        {
+            std::map<std::string, std::string> values;
+            for (size_t c = 0; c < header.size(); ++c)
+            {
+                if (!columnValues[c].empty())
+                {
+                    values[header[c]] = columnValues[c][choice[c]];
+                }
+            }
+            points.push_back(makePoint(values));
+            more = false;
+            for (size_t c = header.size(); c-- > 0;)
+            {
+                if (choice[c] + 1 < columnValues[c].size())
+                {
+                    ++choice[c];
+                    more = true;
+                    break;
+                }
+                choice[c] = 0;
+            }
+        }
+    }
+}
+
+std::string ParameterGrid::header()
+{
+    std::string line;
+    for (const auto &column : columnNames)
+    {
+        line += (line.empty() ? "" : ",") + column;
+    }
+    return line;
+}
+
+void ParameterGrid::writePoint(std::ostream &output, const gridPoint &point)
+{
+    output << point.l << ","
+           << point.p << ","
+           << point.q << ","
+           << point.rounds << ","
+           << point.trials << ","
+           << point.latticeType << ","
+           << point.sweepLimit << ","
+           << point.sweepSchedule << ","
+           << point.timeout << ","
+           << std::boolalpha << point.greedy << ","
+           << point.correlatedErrors << std::noboolalpha << ","
+           << point.sweepRate << ","
+           << point.jobNumber;
+}
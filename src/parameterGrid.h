@@ -0,0 +1,48 @@
+#ifndef PARAMETER_GRID_H
+#define PARAMETER_GRID_H
+
+#include <istream>
+#include <string>
+#include <vector>
+
+// The parameters of one run of trials, as taken by runTrials
+struct gridPoint
+{
+  int l;
+  double p;
+  double q;
+  int rounds;
+  std::string latticeType;
+  int sweepLimit;
+  std::string sweepSchedule;
+  int timeout;
+  bool greedy;
+  bool correlatedErrors;
+  int sweepRate;
+  int trials;
+  int jobNumber;
+};
+
+// Runs read from a CSV file such as input/20_05_20.csv, whose first line
+// names the columns after the arguments of data_generator.py. L, p, cycles
+// and trials must be given, q, lattice_type, sweep_limit, sweep_schedule,
+// timeout, greedy, correlated_errors, sweep_rate and job_number take the
+// defaults of data_generator.py when they are left out. A cell may hold
+// several values separated by spaces, its row then stands for every
+// combination of the values, with the first column varying slowest.
+class ParameterGrid
+{
+private:
+  std::vector<gridPoint> points;
+
+public:
+  ParameterGrid(std::istream &input);
+
+  const std::vector<gridPoint> &getPoints() const { return points; }
+  // Column names of the parameters, in the order of writePoint
+  static std::string header();
+  // Writes the parameters of a point as comma-separated values
+  static void writePoint(std::ostream &output, const gridPoint &point);
+};
+
+#endif
@@ -7,37 +7,65 @@
 #include <algorithm>
 #include <set>
 
-RhombicCode::RhombicCode(const int l, const double p, const double q, bool boundaries, const int sweepRate) : Code(l, p, q, boundaries, sweepRate)
+RhombicCode::RhombicCode(const int l, const double p, const double q, bool boundaries, const int sweepRate) : RhombicCode(buildGeometry(l, boundaries), p, q, sweepRate)
+{
+}
+
+RhombicCode::RhombicCode(std::shared_ptr<const CodeGeometry> geometry, const double p, const double q, const int sweepRate) : Code(geometry, p, q, sweepRate)
+{
+}
+
+std::shared_ptr<Lattice> RhombicCode::buildLattice(const int l, bool boundaries)
 {
     if (boundaries)
     {
-        numberOfFaces = 3 * pow(l - 1, 3) - 4 * pow(l - 1, 2) + 2 * (l - 1);
-        latticeParity = 1;
-        lattice = std::make_unique<RhombicLattice>(l);
-        buildSyndromeIndices();
+        return std::make_shared<RhombicLattice>(l);
     }
-    else
+    return std::make_shared<RhombicToricLattice>(l);
+}
+
+std::shared_ptr<CodeGeometry> RhombicCode::buildGeometry(const int l, bool boundaries)
+{
+    auto geometry = std::make_shared<CodeGeometry>();
+    geometry->l = l;
+    geometry->boundaries = boundaries;
+    geometry->lattice = buildLattice(l, boundaries);
+    if (boundaries)
     {
-        numberOfFaces = 3 * pow(l, 3);
-        latticeParity = 0;
-        lattice = std::make_unique<RhombicToricLattice>(l);
+        geometry->numberOfFaces = 3 * pow(l - 1, 3) - 4 * pow(l - 1, 2) + 2 * (l - 1);
+        buildSyndromeIndices(*geometry);
     }
-    numberOfEdges = 2 * 7 * pow(l, 3);
-    buildSweepIndices();
-    syndrome.assign(numberOfEdges, 0);
-    flipBits.assign(numberOfFaces, 0);
-    lattice->createFaces();
-    lattice->createUpEdgesMap();
-    lattice->createVertexToEdges();
-    upEdgesMap = lattice->getUpEdgesMap();
-    faceToEdges = lattice->getFaceToEdges(); 
-    vertexToEdges = lattice->getVertexToEdges();
-    buildLogicals();
+    else
+    {
+        geometry->numberOfFaces = 3 * pow(l, 3);
+    }
+    geometry->numberOfEdges = geometry->lattice->getNumberOfEdges();
+    buildSweepIndices(*geometry);
+    geometry->lattice->createFaces();
+    geometry->lattice->createUpEdgesMap();
+    geometry->lattice->createVertexToEdges();
+    buildLogicals(*geometry);
+    geometry->buildLogicalMasks();
+    geometry->buildSyndromeEdges();
+    geometry->sweepTable = RhombicCode(geometry, 0, 0, 1).buildSweepTable();
+    // Six faces for every vertex of the w = 0 sub-lattice
+    geometry->buildSweepStencil(6);
+    return geometry;
 }
 
-void RhombicCode::buildSyndromeIndices()
+std::unique_ptr<Code> RhombicCode::clone() const
 {
-    for (int i = 0; i < pow(l, 3); ++i)
+    return std::make_unique<RhombicCode>(*this);
+}
+
+void RhombicCode::buildSyndromeIndices(CodeGeometry &geometry)
+{
+    const int l = geometry.l;
+    auto &lattice = geometry.lattice;
+    auto &syndromeMask = geometry.syndromeMask;
+    syndromeMask.reset(lattice->getNumberOfEdges());
+
+    for (int i = 0; i < lattice->getNumberOfW0Vertices(); ++i)
     {
         const cartesian4 coordinate = lattice->indexToCoordinate(i);
         if (coordinate.z == 0 || coordinate.y == 0 || coordinate.y == l - 1)
@@ -46,69 +74,67 @@ void RhombicCode::buildSyndromeIndices()
         }
         else
         {
-            if ((coordinate.x + coordinate.y + coordinate.z) % 2 == latticeParity)
+            if (coordinate.z == 1)
             {
-                if (coordinate.z == 1)
+                if (coordinate.x != 0)
                 {
-                    if (coordinate.x != 0)
-                    {
-                        syndromeIndices.insert(lattice->edgeIndex(i, "yz", 1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xy", -1));
-                    }
-                    if (coordinate.x != l - 1)
-                    {
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xyz", 1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xz", 1));
-                    }
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::yz, 1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xy, -1));
                 }
-                else if (coordinate.z == l - 1)
+                if (coordinate.x != l - 1)
                 {
-                    if (coordinate.x != 0)
-                    {
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xyz", -1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xz", -1));
-                    }
-                    if (coordinate.x != l - 1)
-                    {
-                        syndromeIndices.insert(lattice->edgeIndex(i, "yz", -1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xy", 1));
-                    }
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xyz, 1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xz, 1));
                 }
-                else
+            }
+            else if (coordinate.z == l - 1)
+            {
+                if (coordinate.x != 0)
                 {
-                    if (coordinate.x != 0)
-                    {
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xyz", -1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xy", -1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xz", -1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "yz", 1));
-                    }
-                    if (coordinate.x != l - 1)
-                    {
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xyz", 1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xy", 1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "xz", 1));
-                        syndromeIndices.insert(lattice->edgeIndex(i, "yz", -1));
-                    }
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xyz, -1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xz, -1));
+                }
+                if (coordinate.x != l - 1)
+                {
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::yz, -1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xy, 1));
+                }
+            }
+            else
+            {
+                if (coordinate.x != 0)
+                {
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xyz, -1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xy, -1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xz, -1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::yz, 1));
+                }
+                if (coordinate.x != l - 1)
+                {
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xyz, 1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xy, 1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::xz, 1));
+                    syndromeMask.set(lattice->edgeIndex(i, Direction::yz, -1));
                 }
             }
         }
     }
 }
 
-void RhombicCode::buildSweepIndices()
+void RhombicCode::buildSweepIndices(CodeGeometry &geometry)
 {
+    const int l = geometry.l;
+    auto &lattice = geometry.lattice;
+    const bool boundaries = geometry.boundaries;
+    auto &sweepIndices = geometry.sweepIndices;
+
     if (boundaries)
     {
-        for (int i = 0; i < 2 * pow(l, 3); ++i)
+        for (int i = 0; i < lattice->getNumberOfVertices(); ++i)
         {
             const cartesian4 coordinate = lattice->indexToCoordinate(i);
             if (coordinate.w == 0)
             {
-                if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
-                {
-                    continue;
-                }
                 if (coordinate.z >= 1 && coordinate.z <= l - 1 && coordinate.x >= 0 && coordinate.x <= l - 1 && coordinate.y >= 1 && coordinate.y <= l - 2)
                 {
                     sweepIndices.push_back(i);
@@ -125,258 +151,109 @@ void RhombicCode::buildSweepIndices()
     }
     else
     {
-        sweepIndices.assign(2 * pow(l, 3), 0);
-        std::iota(std::begin(sweepIndices), std::end(sweepIndices), 0);
+        sweepIndices.assign(lattice->getNumberOfVertices(), 0);
+        std::iota(sweepIndices.begin(), sweepIndices.end(), 0);
     }
 }
 
-void RhombicCode::sweep(const std::string &direction, bool greedy)
+vdir RhombicCode::sweepEdgeDirections(const SignedDirection &direction)
 {
-    clearFlipBits();
-    vstr edgeDirections;
-    if (direction == "xyz")
+    vdir edgeDirections;
+    if (direction == Direction::xyz)
     {
-        edgeDirections = {"xy", "yz", "xz"};
+        edgeDirections = {Direction::xy, Direction::yz, Direction::xz};
     }
-    else if (direction == "xy")
+    else if (direction == Direction::xy)
     {
-        edgeDirections = {"xyz", "-xz", "-yz"};
+        edgeDirections = {Direction::xyz, -Direction::xz, -Direction::yz};
     }
-    else if (direction == "xz")
+    else if (direction == Direction::xz)
     {
-        edgeDirections = {"xyz", "-xy", "-yz"};
+        edgeDirections = {Direction::xyz, -Direction::xy, -Direction::yz};
     }
-    else if (direction == "yz")
+    else if (direction == Direction::yz)
     {
-        edgeDirections = {"xyz", "-xy", "-xz"};
+        edgeDirections = {Direction::xyz, -Direction::xy, -Direction::xz};
     }
-    else if (direction == "-xyz")
+    else if (direction == -Direction::xyz)
     {
-        edgeDirections = {"-xy", "-yz", "-xz"};
+        edgeDirections = {-Direction::xy, -Direction::yz, -Direction::xz};
     }
-    else if (direction == "-xy")
+    else if (direction == -Direction::xy)
     {
-        edgeDirections = {"-xyz", "xz", "yz"};
+        edgeDirections = {-Direction::xyz, Direction::xz, Direction::yz};
     }
-    else if (direction == "-xz")
+    else if (direction == -Direction::xz)
     {
-        edgeDirections = {"-xyz", "xy", "yz"};
+        edgeDirections = {-Direction::xyz, Direction::xy, Direction::yz};
     }
-    else if (direction == "-yz")
+    else if (direction == -Direction::yz)
     {
-        edgeDirections = {"-xyz", "xy", "xz"};
+        edgeDirections = {-Direction::xyz, Direction::xy, Direction::xz};
     }
     else
     {
         throw std::invalid_argument("Invalid sweep direction.");
     }
-    // for (int vertexIndex = 0; vertexIndex < 2 * pow(l, 3); ++vertexIndex)
-    for (auto const vertexIndex : sweepIndices)
+    return edgeDirections;
+}
+
+void RhombicCode::sweepVertex(const int vertexIndex, const SignedDirection &direction, const vdir &edgeDirections)
+{
+    vdir sweepEdges = findSweepEdges(vertexIndex, direction);
+    if (sweepEdges.size() > 4)
     {
-        if (!greedy)
-        {
-            if (!checkExtremalVertex(vertexIndex, direction))
-            {
-                continue;
-            }
-        }
-        // std::cout << "Trying to find sweep edges... ";
-        vstr sweepEdges = findSweepEdges(vertexIndex, direction);
-        // if (sweepEdges.size() > 0)
-        // {
-        //     std::cerr << "Vertex = " << lattice->indexToCoordinate(vertexIndex) << std::endl;
-        //     for (auto &e : sweepEdges)
-        //     {
-        //         std::cerr << e << std::endl;
-        //     }
-        // }
-        // std::cout << "FOUND." << std::endl;
-        if (sweepEdges.size() > 4)
-        {
-            throw std::length_error("More than four up-edges found for a rhombic lattice vertex.");
-        }
-        if (sweepEdges.size() == 0)
-        {
-            continue;
-        }
-        cartesian4 coordinate = lattice->indexToCoordinate(vertexIndex);
-        // if (sweepEdges.size() == 1 && (!boundaries || coordinate.w == 0))
-        if (sweepEdges.size() == 1 && !boundaries)
-        {
-            continue;
-        }
-        if (coordinate.w == 0)
+        throw std::length_error("More than four up-edges found for a rhombic lattice vertex.");
+    }
+    if (sweepEdges.size() == 0)
+    {
+        return;
+    }
+    cartesian4 coordinate = lattice->indexToCoordinate(vertexIndex);
+    // if (sweepEdges.size() == 1 && (!boundaries || coordinate.w == 0))
+    if (sweepEdges.size() == 1 && !boundaries)
+    {
+        return;
+    }
+    if (coordinate.w == 0)
+    {
+        if (boundaries)
         {
-            if ((coordinate.x + coordinate.y + coordinate.z) % 2 == latticeParity)
-            {
-                if (boundaries)
-                {
-                    sweepFullVertexBoundary(vertexIndex, sweepEdges, direction, edgeDirections);
-                }
-                else
-                {
-                    sweepFullVertex(vertexIndex, sweepEdges, direction, edgeDirections);
-                }
-            }
-            else
-            {
-                throw std::invalid_argument("Vertex not present in lattice has up-edges.");
-            }
+            sweepFullVertexBoundary(vertexIndex, sweepEdges, direction, edgeDirections);
         }
         else
         {
-            if (boundaries)
-            {
-                sweepHalfVertexBoundary(vertexIndex, sweepEdges, direction, edgeDirections);
-            }
-            else
-            {
-                sweepHalfVertex(vertexIndex, sweepEdges, direction, edgeDirections);
-            }
+            sweepFullVertex(vertexIndex, sweepEdges, direction, edgeDirections);
         }
     }
-    for (int i = 0, imax = flipBits.size(); i < imax; ++i)
+    else
     {
-        if (flipBits[i])
+        if (boundaries)
         {
-            auto it = error.find(i);
-            if (it != error.end())
-            {
-                error.erase(it);
-            }
-            else
-            {
-                error.insert(i);
-            }
-            if (sweepRate > 1)
-            {
-                for (const int edge : faceToEdges[i])
-                {
-                    // std::cerr << edge << std::endl;
-                    if (boundaries)
-                    {
-                        auto it2 = syndromeIndices.find(edge);
-                        if (it2 == syndromeIndices.end())
-                        {
-                            continue;
-                        }
-                    }
-                    syndrome[edge] = (syndrome[edge] + 1) % 2;
-                }
-            }
+            sweepHalfVertexBoundary(vertexIndex, sweepEdges, direction, edgeDirections);
+        }
+        else
+        {
+            sweepHalfVertex(vertexIndex, sweepEdges, direction, edgeDirections);
         }
     }
 }
 
-vstr RhombicCode::findSweepEdges(const int vertexIndex, const std::string &direction)
+vdir RhombicCode::findSweepEdges(const int vertexIndex, const SignedDirection &direction)
 {
-    vstr sweepEdges;
-    auto &upEdges = upEdgesMap[direction][vertexIndex];
+    vdir sweepEdges;
+    auto upEdges = lattice->getUpEdges(vertexIndex, direction);
     for (const int edge : upEdges)
     {
         if (syndrome[edge] == 1)
         {
-            int xyzEdge = -1, xyEdge = -1, xzEdge = -1, yzEdge = -1;
-            int minusXYZEdge = -1, minusXYEdge = -1, minusXZEdge = -1, minusYZEdge = -1;
-            try
-            {
-                xyzEdge = lattice->edgeIndex(vertexIndex, "xyz", 1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                xyEdge = lattice->edgeIndex(vertexIndex, "xy", 1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                xzEdge = lattice->edgeIndex(vertexIndex, "xz", 1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                yzEdge = lattice->edgeIndex(vertexIndex, "yz", 1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                minusXYZEdge = lattice->edgeIndex(vertexIndex, "xyz", -1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                minusXYEdge = lattice->edgeIndex(vertexIndex, "xy", -1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                minusXZEdge = lattice->edgeIndex(vertexIndex, "xz", -1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-            try
-            {
-                minusYZEdge = lattice->edgeIndex(vertexIndex, "yz", -1);
-            }
-            catch (const std::invalid_argument &e)
-            {
-            }
-
-            if (xyzEdge == edge)
-            {
-                sweepEdges.push_back("xyz");
-            }
-            else if (xyEdge == edge)
-            {
-                sweepEdges.push_back("xy");
-            }
-            else if (yzEdge == edge)
-            {
-                sweepEdges.push_back("yz");
-            }
-            else if (xzEdge == edge)
-            {
-                sweepEdges.push_back("xz");
-            }
-            else if (minusYZEdge == edge)
-            {
-                sweepEdges.push_back("-yz");
-            }
-            else if (minusXZEdge == edge)
-            {
-                sweepEdges.push_back("-xz");
-            }
-            else if (minusXYEdge == edge)
-            {
-                sweepEdges.push_back("-xy");
-            }
-            else if (minusXYZEdge == edge)
-            {
-                sweepEdges.push_back("-xyz");
-            }
-            else
-            {
-                throw std::invalid_argument("Edge index does not correspond to a valid edge.");
-            }
+            sweepEdges.push_back(lattice->edgeDirection(edge, vertexIndex));
         }
     }
     return sweepEdges;
 }
 
-void RhombicCode::sweepFullVertex(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections)
+void RhombicCode::sweepFullVertex(const int vertexIndex, vdir &sweepEdges, const SignedDirection &sweepDirection, const vdir &upEdgeDirections)
 {
     // std::cout << "Sweep of coordinate = " << lattice->indexToCoordinate(vertexIndex) << " ... ";
     auto &edge0 = upEdgeDirections[0];
@@ -386,33 +263,9 @@ void RhombicCode::sweepFullVertex(const int vertexIndex, vstr &sweepEdges, const
     auto sweepDirectionIndex = std::distance(sweepEdges.begin(), std::find(sweepEdges.begin(), sweepEdges.end(), sweepDirection));
     if (sweepEdges.size() == 4)
     {
-        try
-        {
-            vint vertices = faceVertices(vertexIndex, {sweepDirection, edge0, edge0});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-            // std::cerr << "WARNING: " << e.what() << std::endl;
-        }
-        try
-        {
-            vint vertices = faceVertices(vertexIndex, {sweepDirection, edge1, edge1});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-            // std::cerr << "WARNING: " << e.what() << std::endl;
-        }
-        try
-        {
-            vint vertices = faceVertices(vertexIndex, {sweepDirection, edge2, edge2});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-            // std::cerr << "WARNING: " << e.what() << std::endl;
-        }
+        flipFace(vertexIndex, {sweepDirection, edge0, edge0});
+        flipFace(vertexIndex, {sweepDirection, edge1, edge1});
+        flipFace(vertexIndex, {sweepDirection, edge2, edge2});
     }
     else if (sweepDirectionIndex < sweepEdges.size())
     {
@@ -420,44 +273,20 @@ void RhombicCode::sweepFullVertex(const int vertexIndex, vstr &sweepEdges, const
         if (sweepEdges.size() == 2)
         {
             // int delIndex = distInt0To1(mt);
-            int delIndex = distInt0To1(rnEngine);
+            int delIndex = randomChoice(2);
             sweepEdges.erase(sweepEdges.begin() + delIndex);
         }
         if (sweepEdges[0] == edge0)
         {
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge0, edge0});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
+            flipFace(vertexIndex, {sweepDirection, edge0, edge0});
         }
         else if (sweepEdges[0] == edge2)
         {
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge2, edge2});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
+            flipFace(vertexIndex, {sweepDirection, edge2, edge2});
         }
         else if (sweepEdges[0] == edge1)
         {
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge1, edge1});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
+            flipFace(vertexIndex, {sweepDirection, edge1, edge1});
         }
         else
         {
@@ -469,74 +298,26 @@ void RhombicCode::sweepFullVertex(const int vertexIndex, vstr &sweepEdges, const
         if (sweepEdges.size() == 3)
         {
             // int delIndex = distInt0To2(mt);
-            int delIndex = distInt0To2(rnEngine);
+            int delIndex = randomChoice(3);
             sweepEdges.erase(sweepEdges.begin() + delIndex);
         }
         if ((sweepEdges[0] == edge0 && sweepEdges[1] == edge2) ||
             (sweepEdges[0] == edge2 && sweepEdges[1] == edge0))
         {
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge0, edge0});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge2, edge2});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
+            flipFace(vertexIndex, {sweepDirection, edge0, edge0});
+            flipFace(vertexIndex, {sweepDirection, edge2, edge2});
         }
         else if ((sweepEdges[0] == edge0 && sweepEdges[1] == edge1) ||
                  (sweepEdges[0] == edge1 && sweepEdges[1] == edge0))
         {
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge0, edge0});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge1, edge1});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
+            flipFace(vertexIndex, {sweepDirection, edge0, edge0});
+            flipFace(vertexIndex, {sweepDirection, edge1, edge1});
         }
         else if ((sweepEdges[0] == edge1 && sweepEdges[1] == edge2) ||
                  (sweepEdges[0] == edge2 && sweepEdges[1] == edge1))
         {
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge1, edge1});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
-            try
-            {
-                vint vertices = faceVertices(vertexIndex, {sweepDirection, edge2, edge2});
-                localFlip(vertices);
-            }
-            catch (const std::invalid_argument &e)
-            {
-                // std::cerr << "WARNING: " << e.what() << std::endl;
-            }
+            flipFace(vertexIndex, {sweepDirection, edge1, edge1});
+            flipFace(vertexIndex, {sweepDirection, edge2, edge2});
         }
         else
         {
@@ -546,7 +327,14 @@ void RhombicCode::sweepFullVertex(const int vertexIndex, vstr &sweepEdges, const
     // std::cout << "Successful." << std::endl;
 }
 
-void RhombicCode::sweepHalfVertex(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections)
+void RhombicCode::sweepFullVertex(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections)
+{
+    vdir edges = toSignedDirections(sweepEdges);
+    sweepFullVertex(vertexIndex, edges, toSignedDirection(sweepDirection), toSignedDirections(upEdgeDirections));
+    sweepEdges = toStrings(edges);
+}
+
+void RhombicCode::sweepHalfVertex(const int vertexIndex, vdir &sweepEdges, const SignedDirection &sweepDirection, const vdir &upEdgeDirections)
 {
     // std::cout << "Sweep of coordinate = " << lattice->indexToCoordinate(vertexIndex) << " ... ";
     auto &edge0 = upEdgeDirections[0];
@@ -555,50 +343,23 @@ void RhombicCode::sweepHalfVertex(const int vertexIndex, vstr &sweepEdges, const
     if (sweepEdges.size() == 3)
     {
         // int delIndex = distInt0To2(mt);
-        int delIndex = distInt0To2(rnEngine);
+        int delIndex = randomChoice(3);
         sweepEdges.erase(sweepEdges.begin() + delIndex);
     }
     if ((sweepEdges[0] == edge0 && sweepEdges[1] == edge2) ||
         (sweepEdges[0] == edge2 && sweepEdges[1] == edge0))
     {
-        vint vertices;
-        try
-        {
-            vertices = faceVertices(vertexIndex, {edge0, edge2, edge2});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-            // std::cerr << "WARNING: " << e.what() << std::endl;
-        }
+        flipFace(vertexIndex, {edge0, edge2, edge2});
     }
     else if ((sweepEdges[0] == edge0 && sweepEdges[1] == edge1) ||
              (sweepEdges[0] == edge1 && sweepEdges[1] == edge0))
     {
-        vint vertices;
-        try
-        {
-            vertices = faceVertices(vertexIndex, {edge0, edge1, edge1});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-            // std::cerr << "WARNING: " << e.what() << std::endl;
-        }
+        flipFace(vertexIndex, {edge0, edge1, edge1});
     }
     else if ((sweepEdges[0] == edge1 && sweepEdges[1] == edge2) ||
              (sweepEdges[0] == edge2 && sweepEdges[1] == edge1))
     {
-        vint vertices;
-        try
-        {
-            vertices = faceVertices(vertexIndex, {edge2, edge1, edge1});
-            localFlip(vertices);
-        }
-        catch (const std::invalid_argument &e)
-        {
-            // std::cerr << "WARNING: " << e.what() << std::endl;
-        }
+        flipFace(vertexIndex, {edge2, edge1, edge1});
     }
     else
     {
@@ -607,95 +368,93 @@ void RhombicCode::sweepHalfVertex(const int vertexIndex, vstr &sweepEdges, const
     // std::cout << "Successful." << std::endl;
 }
 
-void RhombicCode::sweepHalfVertexBoundary(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections)
+void RhombicCode::sweepHalfVertex(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections)
+{
+    vdir edges = toSignedDirections(sweepEdges);
+    sweepHalfVertex(vertexIndex, edges, toSignedDirection(sweepDirection), toSignedDirections(upEdgeDirections));
+    sweepEdges = toStrings(edges);
+}
+
+void RhombicCode::sweepHalfVertexBoundary(const int vertexIndex, vdir &sweepEdges, const SignedDirection &sweepDirection, const vdir &upEdgeDirections)
 {
     // Only sweep one edge faces 
     cartesian4 coordinate = lattice->indexToCoordinate(vertexIndex);
     bool sweepComplete = false;
     if (sweepEdges.size() == 1)
     {
-        vint vertices;
         if (coordinate.y == 0 && coordinate.x == l - 2)
         {
-            if (sweepEdges[0] == "xy")
+            if (sweepEdges[0] == Direction::xy)
             {
-                if (sweepDirection == "-yz" || sweepDirection == "-xz")
+                if (sweepDirection == -Direction::yz || sweepDirection == -Direction::xz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xy", "-xyz", "-xyz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xy, -Direction::xyz, -Direction::xyz});
                 }
                 sweepComplete = true;
             }
-            else if (sweepEdges[0] == "xyz")
+            else if (sweepEdges[0] == Direction::xyz)
             {
-                if (sweepDirection == "xz" || sweepDirection == "yz")
+                if (sweepDirection == Direction::xz || sweepDirection == Direction::yz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xyz", "-xy", "-xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xyz, -Direction::xy, -Direction::xy});
                 }
                 sweepComplete = true;
             }
         }
         else if (coordinate.y == 0 && coordinate.x == 0)
         {
-            if (sweepEdges[0] == "-xz")
+            if (sweepEdges[0] == -Direction::xz)
             {
-                if (sweepDirection == "xy" || sweepDirection == "-xyz")
+                if (sweepDirection == Direction::xy || sweepDirection == -Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xz", "-yz", "-yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xz, -Direction::yz, -Direction::yz});
                 }
                 sweepComplete = true;
 
             }
-            else if (sweepEdges[0] == "yz")
+            else if (sweepEdges[0] == Direction::yz)
             {
-                if (sweepDirection == "-xy" || sweepDirection == "xyz")
+                if (sweepDirection == -Direction::xy || sweepDirection == Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"yz", "xz", "xz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::yz, Direction::xz, Direction::xz});
                 }
                 sweepComplete = true;
             }
         }
         else if (coordinate.y == l - 2 && coordinate.x == 0)
         {
-            if (sweepEdges[0] == "-xyz")
+            if (sweepEdges[0] == -Direction::xyz)
             {
-                if (sweepDirection == "-xz" || sweepDirection == "-yz")
+                if (sweepDirection == -Direction::xz || sweepDirection == -Direction::yz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xyz", "xy", "xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xyz, Direction::xy, Direction::xy});
                 }
                 sweepComplete = true;
             }
-            else if (sweepEdges[0] == "-xy")
+            else if (sweepEdges[0] == -Direction::xy)
             {
-                if (sweepDirection == "xz" || sweepDirection == "yz")
+                if (sweepDirection == Direction::xz || sweepDirection == Direction::yz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xyz", "-xy", "-xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xyz, -Direction::xy, -Direction::xy});
                 }
                 sweepComplete = true;
             }
         }
         else if (coordinate.y == l - 2 && coordinate.x == l - 2)
         {
-            if (sweepEdges[0] == "-yz")
+            if (sweepEdges[0] == -Direction::yz)
             {
-                if (sweepDirection == "xy" || sweepDirection == "-xyz")
+                if (sweepDirection == Direction::xy || sweepDirection == -Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xz", "-yz", "-yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xz, -Direction::yz, -Direction::yz});
                 }
                 sweepComplete = true;
             }
-            else if (sweepEdges[0] == "xz")
+            else if (sweepEdges[0] == Direction::xz)
             {
-                if (sweepDirection == "-xy" || sweepDirection == "xyz")
+                if (sweepDirection == -Direction::xy || sweepDirection == Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xz", "yz", "yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xz, Direction::yz, Direction::yz});
                 }
                 sweepComplete = true;
             }
@@ -708,288 +467,151 @@ void RhombicCode::sweepHalfVertexBoundary(const int vertexIndex, vstr &sweepEdge
     }
 }
 
-void RhombicCode::sweepHalfVertexBulkBoundary(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections)
+void RhombicCode::sweepHalfVertexBulkBoundary(const int vertexIndex, vdir &sweepEdges, const SignedDirection &sweepDirection, const vdir &upEdgeDirections)
 {
     // Makes the rule non-deterministic for perfect measurements 
     cartesian4 coordinate = lattice->indexToCoordinate(vertexIndex);
     if (sweepEdges.size() == 1)
     {
-        vint vertices;
         if (coordinate.y == 0)
         {
-            if (sweepEdges[0] == "xy")
+            if (sweepEdges[0] == Direction::xy)
             {
-                if (sweepDirection == "-xz")
+                if (sweepDirection == -Direction::xz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xy", "-xyz", "-xyz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xy, -Direction::xyz, -Direction::xyz});
                 }
-                else if (sweepDirection == "xyz")
+                else if (sweepDirection == Direction::xyz)
                 {
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"xy", "xz", "xz"});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    flipFace(vertexIndex, {Direction::xy, Direction::xz, Direction::xz});
                 }
-                else if (sweepDirection == "-yz")
+                else if (sweepDirection == -Direction::yz)
                 {
-                    int index = distInt0To1(rnEngine);
-                    vstr dirs = {"-xyz", "xz"};
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"xy", dirs[index], dirs[index]});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    int index = randomChoice(2);
+                    vdir dirs = {-Direction::xyz, Direction::xz};
+                    flipFace(vertexIndex, {Direction::xy, dirs[index], dirs[index]});
                 }
             }
-            else if (sweepEdges[0] == "yz")
+            else if (sweepEdges[0] == Direction::yz)
             {
-                if (sweepDirection == "xyz")
+                if (sweepDirection == Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"yz", "xz", "xz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::yz, Direction::xz, Direction::xz});
                 }
-                else if (sweepDirection == "-xz")
+                else if (sweepDirection == -Direction::xz)
                 {
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"yz", "-xyz", "-xyz"});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    flipFace(vertexIndex, {Direction::yz, -Direction::xyz, -Direction::xyz});
                 }
-                else if (sweepDirection == "-xy")
+                else if (sweepDirection == -Direction::xy)
                 {
-                    int index = distInt0To1(rnEngine);
-                    vstr dirs = {"-xyz", "xz"};
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"yz", dirs[index], dirs[index]});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    int index = randomChoice(2);
+                    vdir dirs = {-Direction::xyz, Direction::xz};
+                    flipFace(vertexIndex, {Direction::yz, dirs[index], dirs[index]});
                 }
             }
-            else if (sweepEdges[0] == "-xz")
+            else if (sweepEdges[0] == -Direction::xz)
             {
-                if (sweepDirection == "xy")
+                if (sweepDirection == Direction::xy)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xz", "-yz", "-yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xz, -Direction::yz, -Direction::yz});
                 }
-                else if (sweepDirection == "yz")
+                else if (sweepDirection == Direction::yz)
                 {
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"-xz", "-xy", "-xy"});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    flipFace(vertexIndex, {-Direction::xz, -Direction::xy, -Direction::xy});
                 }
-                else if (sweepDirection == "-xyz")
+                else if (sweepDirection == -Direction::xyz)
                 {
-                    int index = distInt0To1(rnEngine);
-                    vstr dirs = {"-xy", "-yz"};
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"-xz", dirs[index], dirs[index]});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    int index = randomChoice(2);
+                    vdir dirs = {-Direction::xy, -Direction::yz};
+                    flipFace(vertexIndex, {-Direction::xz, dirs[index], dirs[index]});
                 }
             }
-            else if (sweepEdges[0] == "xyz")
+            else if (sweepEdges[0] == Direction::xyz)
             {
-                if (sweepDirection == "yz")
+                if (sweepDirection == Direction::yz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xyz", "-xy", "-xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xyz, -Direction::xy, -Direction::xy});
                 }
-                else if (sweepDirection == "xy")
+                else if (sweepDirection == Direction::xy)
                 {
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"xyz", "-yz", "-yz"});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    flipFace(vertexIndex, {Direction::xyz, -Direction::yz, -Direction::yz});
                 }
-                else if (sweepDirection == "xz")
+                else if (sweepDirection == Direction::xz)
                 {
-                    int index = distInt0To1(rnEngine);
-                    vstr dirs = {"-xy", "-yz"};
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"xyz", dirs[index], dirs[index]});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    int index = randomChoice(2);
+                    vdir dirs = {-Direction::xy, -Direction::yz};
+                    flipFace(vertexIndex, {Direction::xyz, dirs[index], dirs[index]});
                 }
             }
         }
         else if (coordinate.y == l - 2)
         {
-            if (sweepEdges[0] == "-xyz")
+            if (sweepEdges[0] == -Direction::xyz)
             {
-                if (sweepDirection == "-yz")
+                if (sweepDirection == -Direction::yz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xyz", "xy", "xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xyz, Direction::xy, Direction::xy});
                 }
-                else if (sweepDirection == "-xy")
+                else if (sweepDirection == -Direction::xy)
                 {
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"-xyz", "yz", "yz"});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    flipFace(vertexIndex, {-Direction::xyz, Direction::yz, Direction::yz});
                 }
-                else if (sweepDirection == "-xz")
+                else if (sweepDirection == -Direction::xz)
                 {
-                    int index = distInt0To1(rnEngine);
-                    vstr dirs = {"xy", "yz"};
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"-xyz", dirs[index], dirs[index]});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    int index = randomChoice(2);
+                    vdir dirs = {Direction::xy, Direction::yz};
+                    flipFace(vertexIndex, {-Direction::xyz, dirs[index], dirs[index]});
                 }
             }
-            else if (sweepEdges[0] == "xz")
+            else if (sweepEdges[0] == Direction::xz)
             {
-                if (sweepDirection == "-xy")
+                if (sweepDirection == -Direction::xy)
                 {
-                    vertices = faceVertices(vertexIndex, {"xz", "yz", "yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xz, Direction::yz, Direction::yz});
                 }
-                else if (sweepDirection == "-yz")
+                else if (sweepDirection == -Direction::yz)
                 {
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"xz", "xy", "xy"});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    flipFace(vertexIndex, {Direction::xz, Direction::xy, Direction::xy});
                 }
-                else if (sweepDirection == "xyz")
+                else if (sweepDirection == Direction::xyz)
                 {
-                    int index = distInt0To1(rnEngine);
-                    vstr dirs = {"xy", "yz"};
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"xz", dirs[index], dirs[index]});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    int index = randomChoice(2);
+                    vdir dirs = {Direction::xy, Direction::yz};
+                    flipFace(vertexIndex, {Direction::xz, dirs[index], dirs[index]});
                 }
             }
-            else if (sweepEdges[0] == "-yz")
+            else if (sweepEdges[0] == -Direction::yz)
             {
-                if (sweepDirection == "-xyz")
+                if (sweepDirection == -Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-yz", "-xz", "-xz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::yz, -Direction::xz, -Direction::xz});
                 }
-                else if (sweepDirection == "xz")
+                else if (sweepDirection == Direction::xz)
                 {
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"-yz", "xyz", "xyz"});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    flipFace(vertexIndex, {-Direction::yz, Direction::xyz, Direction::xyz});
                 }
-                else if (sweepDirection == "xy")
+                else if (sweepDirection == Direction::xy)
                 {
-                    int index = distInt0To1(rnEngine);
-                    vstr dirs = {"xyz", "-xz"};
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"-yz", dirs[index], dirs[index]});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    int index = randomChoice(2);
+                    vdir dirs = {Direction::xyz, -Direction::xz};
+                    flipFace(vertexIndex, {-Direction::yz, dirs[index], dirs[index]});
                 }
             }
-            else if (sweepEdges[0] == "-xy")
+            else if (sweepEdges[0] == -Direction::xy)
             {
-                if (sweepDirection == "xz")
+                if (sweepDirection == Direction::xz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xy", "xyz", "xyz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xy, Direction::xyz, Direction::xyz});
                 }
-                else if (sweepDirection == "-xyz")
+                else if (sweepDirection == -Direction::xyz)
                 {
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"-xy", "-xz", "-xz"});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    flipFace(vertexIndex, {-Direction::xy, -Direction::xz, -Direction::xz});
                 }
-                else if (sweepDirection == "yz")
+                else if (sweepDirection == Direction::yz)
                 {
-                    int index = distInt0To1(rnEngine);
-                    vstr dirs = {"xyz", "-xz"};
-                    try
-                    {
-                        vertices = faceVertices(vertexIndex, {"-xy", dirs[index], dirs[index]});
-                        localFlip(vertices);
-                    }
-                    catch (const std::invalid_argument &e)
-                    {
-                        std::cerr << "WARNING: " << e.what() << std::endl;
-                    }
+                    int index = randomChoice(2);
+                    vdir dirs = {Direction::xyz, -Direction::xz};
+                    flipFace(vertexIndex, {-Direction::xy, dirs[index], dirs[index]});
                 }
             }
         }
@@ -1000,80 +622,71 @@ void RhombicCode::sweepHalfVertexBulkBoundary(const int vertexIndex, vstr &sweep
     }
 }
 
-void RhombicCode::sweepFullVertexBoundary(const int vertexIndex, vstr &sweepEdges, const std::string &sweepDirection, const vstr &upEdgeDirections)
+void RhombicCode::sweepFullVertexBoundary(const int vertexIndex, vdir &sweepEdges, const SignedDirection &sweepDirection, const vdir &upEdgeDirections)
 {
     // Sweep all awkward faces on z=1 and z=l-1 boundaries
     cartesian4 coordinate = lattice->indexToCoordinate(vertexIndex);
     if (sweepEdges.size() == 1)
     {
-        vint vertices;
         if (coordinate.z == 1) 
         {
-            if (sweepEdges[0] == "xz")
+            if (sweepEdges[0] == Direction::xz)
             {
-                if (sweepDirection == "-yz" || sweepDirection == "xz")
+                if (sweepDirection == -Direction::yz || sweepDirection == Direction::xz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xz", "-yz", "-yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xz, -Direction::yz, -Direction::yz});
                 }
             }
-            else if (sweepEdges[0] == "-xy")
+            else if (sweepEdges[0] == -Direction::xy)
             {
-                if (sweepDirection == "-xy" || sweepDirection == "-xyz")
+                if (sweepDirection == -Direction::xy || sweepDirection == -Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xyz", "-xy", "-xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xyz, -Direction::xy, -Direction::xy});
                 }
             }
-            else if (sweepEdges[0] == "yz")
+            else if (sweepEdges[0] == Direction::yz)
             {
-                if (sweepDirection == "-xz" || sweepDirection == "yz")
+                if (sweepDirection == -Direction::xz || sweepDirection == Direction::yz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xz", "yz", "yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xz, Direction::yz, Direction::yz});
                 }
             }
-            else if (sweepEdges[0] == "xyz")
+            else if (sweepEdges[0] == Direction::xyz)
             {
-                if (sweepDirection == "xy" || sweepDirection == "xyz")
+                if (sweepDirection == Direction::xy || sweepDirection == Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xyz", "xy", "xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xyz, Direction::xy, Direction::xy});
                 }
             }
         }
         else if (coordinate.z == l - 1)
         {    
-            if (sweepEdges[0] == "-yz")
+            if (sweepEdges[0] == -Direction::yz)
             {
-                if (sweepDirection == "-yz" || sweepDirection == "xz")
+                if (sweepDirection == -Direction::yz || sweepDirection == Direction::xz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xz", "-yz", "-yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xz, -Direction::yz, -Direction::yz});
                 }
             }
-            else if (sweepEdges[0] == "-xyz")
+            else if (sweepEdges[0] == -Direction::xyz)
             {
-                if (sweepDirection == "-xy" || sweepDirection == "-xyz")
+                if (sweepDirection == -Direction::xy || sweepDirection == -Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xyz", "-xy", "-xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xyz, -Direction::xy, -Direction::xy});
                 }
             }
-            else if (sweepEdges[0] == "-xz")
+            else if (sweepEdges[0] == -Direction::xz)
             {
-                if (sweepDirection == "-xz" || sweepDirection == "yz")
+                if (sweepDirection == -Direction::xz || sweepDirection == Direction::yz)
                 {
-                    vertices = faceVertices(vertexIndex, {"-xz", "yz", "yz"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {-Direction::xz, Direction::yz, Direction::yz});
                 }
             }
-            else if (sweepEdges[0] == "xy")
+            else if (sweepEdges[0] == Direction::xy)
             {
-                if (sweepDirection == "xy" || sweepDirection == "xyz")
+                if (sweepDirection == Direction::xy || sweepDirection == Direction::xyz)
                 {
-                    vertices = faceVertices(vertexIndex, {"xyz", "xy", "xy"});
-                    localFlip(vertices);
+                    flipFace(vertexIndex, {Direction::xyz, Direction::xy, Direction::xy});
                 }
             }
         }
@@ -1084,30 +697,34 @@ void RhombicCode::sweepFullVertexBoundary(const int vertexIndex, vstr &sweepEdge
     }
 }
 
-void RhombicCode::buildLogicals()
+void RhombicCode::buildLogicals(CodeGeometry &geometry)
 {
+    const int l = geometry.l;
+    auto &lattice = geometry.lattice;
+    const bool boundaries = geometry.boundaries;
+
     if (boundaries)
     {
         for (int i = 0; i < l; i += 2)
         {
             cartesian4 coordinate = {i, 0, 1, 0};
             int vertexIndex = lattice->coordinateToIndex(coordinate);
-            int neighbourVertex = lattice->neighbour(vertexIndex, "xyz", 1);
+            int neighbourVertex = lattice->neighbour(vertexIndex, Direction::xyz, 1);
             vint faceVertices = {vertexIndex,
                                  neighbourVertex,
-                                 lattice->neighbour(vertexIndex, "xy", 1),
-                                 lattice->neighbour(neighbourVertex, "xy", 1)};
+                                 lattice->neighbour(vertexIndex, Direction::xy, 1),
+                                 lattice->neighbour(neighbourVertex, Direction::xy, 1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ1.push_back(lattice->findFace(faceVertices));
+            geometry.logicalZ1.push_back(lattice->findFace(faceVertices));
             if (i != 0)
             {
-                neighbourVertex = lattice->neighbour(vertexIndex, "yz", 1);
+                neighbourVertex = lattice->neighbour(vertexIndex, Direction::yz, 1);
                 faceVertices = {vertexIndex,
                                 neighbourVertex,
-                                lattice->neighbour(vertexIndex, "xz", -1),
-                                lattice->neighbour(neighbourVertex, "xz", -1)};
+                                lattice->neighbour(vertexIndex, Direction::xz, -1),
+                                lattice->neighbour(neighbourVertex, Direction::xz, -1)};
                 std::sort(faceVertices.begin(), faceVertices.end());
-                logicalZ1.push_back(lattice->findFace(faceVertices));
+                geometry.logicalZ1.push_back(lattice->findFace(faceVertices));
             }
         }
     }
@@ -1116,56 +733,56 @@ void RhombicCode::buildLogicals()
         for (int i = 0; i < l; i += 2)
         {
             int vertexIndex = lattice->coordinateToIndex({i, 0, 0, 0});
-            int neighbourVertex = lattice->neighbour(vertexIndex, "xz", -1);
+            int neighbourVertex = lattice->neighbour(vertexIndex, Direction::xz, -1);
             vint faceVertices = {vertexIndex,
                                  neighbourVertex,
-                                 lattice->neighbour(vertexIndex, "xyz", -1),
-                                 lattice->neighbour(neighbourVertex, "xyz", -1)};
+                                 lattice->neighbour(vertexIndex, Direction::xyz, -1),
+                                 lattice->neighbour(neighbourVertex, Direction::xyz, -1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ1.push_back(lattice->findFace(faceVertices));
-            neighbourVertex = lattice->neighbour(vertexIndex, "xy", 1);
+            geometry.logicalZ1.push_back(lattice->findFace(faceVertices));
+            neighbourVertex = lattice->neighbour(vertexIndex, Direction::xy, 1);
             faceVertices = {vertexIndex,
                             neighbourVertex,
-                            lattice->neighbour(vertexIndex, "yz", -1),
-                            lattice->neighbour(neighbourVertex, "yz", -1)};
+                            lattice->neighbour(vertexIndex, Direction::yz, -1),
+                            lattice->neighbour(neighbourVertex, Direction::yz, -1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ1.push_back(lattice->findFace(faceVertices));
+            geometry.logicalZ1.push_back(lattice->findFace(faceVertices));
         }
         for (int i = 0; i < l; i += 2)
         {
             int vertexIndex = lattice->coordinateToIndex({0, i, 0, 0});
-            int neighbourVertex = lattice->neighbour(vertexIndex, "yz", -1);
+            int neighbourVertex = lattice->neighbour(vertexIndex, Direction::yz, -1);
             vint faceVertices = {vertexIndex,
                                  neighbourVertex,
-                                 lattice->neighbour(vertexIndex, "xyz", -1),
-                                 lattice->neighbour(neighbourVertex, "xyz", -1)};
+                                 lattice->neighbour(vertexIndex, Direction::xyz, -1),
+                                 lattice->neighbour(neighbourVertex, Direction::xyz, -1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ2.push_back(lattice->findFace(faceVertices));
-            neighbourVertex = lattice->neighbour(vertexIndex, "xy", 1);
+            geometry.logicalZ2.push_back(lattice->findFace(faceVertices));
+            neighbourVertex = lattice->neighbour(vertexIndex, Direction::xy, 1);
             faceVertices = {vertexIndex,
                             neighbourVertex,
-                            lattice->neighbour(vertexIndex, "xz", -1),
-                            lattice->neighbour(neighbourVertex, "xz", -1)};
+                            lattice->neighbour(vertexIndex, Direction::xz, -1),
+                            lattice->neighbour(neighbourVertex, Direction::xz, -1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ2.push_back(lattice->findFace(faceVertices));
+            geometry.logicalZ2.push_back(lattice->findFace(faceVertices));
         }
         for (int i = 0; i < l; i += 2)
         {
             int vertexIndex = lattice->coordinateToIndex({0, 0, i, 0});
-            int neighbourVertex = lattice->neighbour(vertexIndex, "xz", -1);
+            int neighbourVertex = lattice->neighbour(vertexIndex, Direction::xz, -1);
             vint faceVertices = {vertexIndex,
                                  neighbourVertex,
-                                 lattice->neighbour(vertexIndex, "xyz", -1),
-                                 lattice->neighbour(neighbourVertex, "xyz", -1)};
+                                 lattice->neighbour(vertexIndex, Direction::xyz, -1),
+                                 lattice->neighbour(neighbourVertex, Direction::xyz, -1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ3.push_back(lattice->findFace(faceVertices));
-            neighbourVertex = lattice->neighbour(vertexIndex, "yz", 1);
+            geometry.logicalZ3.push_back(lattice->findFace(faceVertices));
+            neighbourVertex = lattice->neighbour(vertexIndex, Direction::yz, 1);
             faceVertices = {vertexIndex,
                             neighbourVertex,
-                            lattice->neighbour(vertexIndex, "xy", -1),
-                            lattice->neighbour(neighbourVertex, "xy", -1)};
+                            lattice->neighbour(vertexIndex, Direction::xy, -1),
+                            lattice->neighbour(neighbourVertex, Direction::xy, -1)};
             std::sort(faceVertices.begin(), faceVertices.end());
-            logicalZ3.push_back(lattice->findFace(faceVertices));
+            geometry.logicalZ3.push_back(lattice->findFace(faceVertices));
         }
     }
 }
\ No newline at end of file
@@ -5,7 +5,6 @@
 #include <cmath>
 #include <algorithm>
 #include <map>
-#include <sstream>
 
 RhombicLattice::RhombicLattice(const int l) : Lattice(l)
 {
@@ -21,18 +20,21 @@ RhombicLattice::RhombicLattice(const int l) : Lattice(l)
     int numberOfFaces = 3 * pow(l - 1, 3) - 4 * pow(l - 1, 2) + 2 * (l - 1);
     faceToVertices.reserve(numberOfFaces);
     faceToEdges.reserve(numberOfFaces);
-    vertexToFaces.assign(2 * l * l * l, {});
-    vertexToEdges.assign(2 * l * l * l, {});
+    // Only the odd sites of the w = 0 sub-lattice hold a vertex
+    numberVertices(2, 1);
+    createNeighbours({Direction::xyz, Direction::xy, Direction::xz, Direction::yz});
+    numberEdges({Direction::xyz, Direction::xy, Direction::xz, Direction::yz,
+                 -Direction::xyz, -Direction::xy, -Direction::xz, -Direction::yz});
 }
 
-int RhombicLattice::neighbour(const int vertexIndex, const std::string &direction, const int sign)
+int RhombicLattice::computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const
 {
     if (!(sign == 1 || sign == -1))
     {
         throw std::invalid_argument("Sign must be either 1 or -1.");
     }
-    if (!(direction == "xy" || direction == "xz" || direction == "yz" ||
-          direction == "xyz"))
+    if (!(direction == Direction::xy || direction == Direction::xz || direction == Direction::yz ||
+          direction == Direction::xyz))
     {
         throw std::invalid_argument("Direction must be one of 'xy', 'xz', 'yz' or 'xyz'.");
     }
@@ -40,28 +42,28 @@ int RhombicLattice::neighbour(const int vertexIndex, const std::string &directio
     coordinate = indexToCoordinate(vertexIndex);
     if (coordinate.w == 1)
     {
-        if (direction == "xy")
+        if (direction == Direction::xy)
         {
             coordinate.x = (coordinate.x + (sign > 0));
             coordinate.y = (coordinate.y + (sign > 0));
             coordinate.z = (coordinate.z + (sign < 0));
             coordinate.w = 0;
         }
-        if (direction == "xz")
+        if (direction == Direction::xz)
         {
             coordinate.x = (coordinate.x + (sign > 0));
             coordinate.z = (coordinate.z + (sign > 0));
             coordinate.y = (coordinate.y + (sign < 0));
             coordinate.w = 0;
         }
-        if (direction == "yz")
+        if (direction == Direction::yz)
         {
             coordinate.y = (coordinate.y + (sign > 0));
             coordinate.z = (coordinate.z + (sign > 0));
             coordinate.x = (coordinate.x + (sign < 0));
             coordinate.w = 0;
         }
-        if (direction == "xyz")
+        if (direction == Direction::xyz)
         {
             coordinate.x = (coordinate.x + (sign > 0));
             coordinate.y = (coordinate.y + (sign > 0));
@@ -71,28 +73,28 @@ int RhombicLattice::neighbour(const int vertexIndex, const std::string &directio
     }
     else
     {
-        if (direction == "xy")
+        if (direction == Direction::xy)
         {
             coordinate.x = (coordinate.x - (sign < 0));
             coordinate.y = (coordinate.y - (sign < 0));
             coordinate.z = (coordinate.z - (sign > 0));
             coordinate.w = 1;
         }
-        if (direction == "xz")
+        if (direction == Direction::xz)
         {
             coordinate.x = (coordinate.x - (sign < 0));
             coordinate.z = (coordinate.z - (sign < 0));
             coordinate.y = (coordinate.y - (sign > 0));
             coordinate.w = 1;
         }
-        if (direction == "yz")
+        if (direction == Direction::yz)
         {
             coordinate.y = (coordinate.y - (sign < 0));
             coordinate.z = (coordinate.z - (sign < 0));
             coordinate.x = (coordinate.x - (sign > 0));
             coordinate.w = 1;
         }
-        if (direction == "xyz")
+        if (direction == Direction::xyz)
         {
             coordinate.x = (coordinate.x - (sign < 0));
             coordinate.y = (coordinate.y - (sign < 0));
@@ -102,195 +104,177 @@ int RhombicLattice::neighbour(const int vertexIndex, const std::string &directio
     }
     if (coordinate.x < 0 || coordinate.x >= l || coordinate.y < 0 || coordinate.y >= l || coordinate.z < 0 || coordinate.z >= l)
     {
-        std::ostringstream stream;
-        cartesian4 errorCoord = indexToCoordinate(vertexIndex);
-        std::string errorDir;
-        if (sign == 1)
-        {
-            errorDir = "+" + direction;
-        }
-        else if (sign == -1)
-        {
-            errorDir = "-" + direction;
-        }
-        stream << "RhombicLattice::neighbour, " << errorDir << " neighbour of " << errorCoord << " is outside the lattice.";
-        std::string errorMessage = stream.str();
-        throw std::invalid_argument(errorMessage);
-    }
-    else
-    {
-        return coordinateToIndex(coordinate);
+        return -1;
     }
+    return coordinateToIndex(coordinate);
 }
 
 void RhombicLattice::createFaces()
 {
     int faceIndex = 0;
-    for (int vertexIndex = 0; vertexIndex < pow(l, 3); ++vertexIndex)
+    for (int vertexIndex = 0; vertexIndex < numberOfW0Vertices; ++vertexIndex)
     {
         cartesian4 coordinate = indexToCoordinate(vertexIndex);
-        if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 1)
+        if (coordinate.z == 0)
         {
-            if (coordinate.z == 0)
+            continue;
+        }
+        else if (coordinate.z % 2 == 1)
+        {
+            if (coordinate.y == 0)
             {
-                continue;
+                addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
+                ++faceIndex;
             }
-            else if (coordinate.z % 2 == 1)
+            else if (coordinate.x == 0)
             {
-                if (coordinate.y == 0)
+                addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
+                ++faceIndex;
+                if (coordinate.z != l - 1)
                 {
-                    addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
+                    addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {1, 1, 1, 1});
                     ++faceIndex;
                 }
-                else if (coordinate.x == 0)
+                if (coordinate.z != 1)
                 {
-                    addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
+                    addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {1, -1, -1, 1});
                     ++faceIndex;
-                    if (coordinate.z != l - 1)
-                    {
-                        addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {1, 1, 1, 1});
-                        ++faceIndex;
-                    }
-                    if (coordinate.z != 1)
-                    {
-                        addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {1, -1, -1, 1});
-                        ++faceIndex;
-                    }
-                }
-                else if (coordinate.x == l - 1)
-                {
-                    if (coordinate.y == l - 1)
-                    {
-                        continue;
-                    }
-                    addFace(vertexIndex, faceIndex, {"yz", "xz", "xz", "yz"}, {1, -1, -1, 1});
-                    ++faceIndex;
-                    if (coordinate.z != l - 1)
-                    {
-                        addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {-1, 1, 1, -1});
-                        ++faceIndex;
-                    }
-                    if (coordinate.z != 1)
-                    {
-                        addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {-1, -1, -1, -1});
-                        ++faceIndex;
-                    }
                 }
-                else if (coordinate.y == l - 1)
+            }
+            else if (coordinate.x == l - 1)
+            {
+                if (coordinate.y == l - 1)
                 {
-                    addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
-                    ++faceIndex;
+                    continue;
                 }
-                else if (coordinate.x % 2 == 0 && coordinate.y % 2 == 0)
+                addFace(vertexIndex, faceIndex, {"yz", "xz", "xz", "yz"}, {1, -1, -1, 1});
+                ++faceIndex;
+                if (coordinate.z != l - 1)
                 {
-                    if (coordinate.z != l - 1)
-                    {
-                        addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {1, 1, 1, 1});
-                        ++faceIndex;
-                        addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {-1, 1, 1, -1});
-                        ++faceIndex;
-                    }
-                    if (coordinate.z != 1)
-                    {
-                        addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {1, -1, -1, 1});
-                        ++faceIndex;
-                        addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {-1, -1, -1, -1});
-                        ++faceIndex;
-                    }
-                    addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {-1, -1, -1, -1});
+                    addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {-1, 1, 1, -1});
                     ++faceIndex;
                 }
-                else if (coordinate.x % 2 == 1 && coordinate.y % 2 == 1)
+                if (coordinate.z != 1)
                 {
-                    if (coordinate.z != l - 1)
-                    {
-                        addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {1, 1, 1, 1});
-                        ++faceIndex;
-                        addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {-1, 1, 1, -1});
-                        ++faceIndex;
-                    }
-                    if (coordinate.z != 1)
-                    {
-                        addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {1, -1, -1, 1});
-                        ++faceIndex;
-                        addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {-1, -1, -1, -1});
-                        ++faceIndex;
-                    }
-                    addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {-1, 1, 1, -1});
+                    addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {-1, -1, -1, -1});
                     ++faceIndex;
                 }
             }
-            else
+            else if (coordinate.y == l - 1)
             {
-                if (coordinate.x == 0)
-                {
-                    addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
-                    ++faceIndex;
-                }
-                else if (coordinate.y == 0)
+                addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
+                ++faceIndex;
+            }
+            else if (coordinate.x % 2 == 0 && coordinate.y % 2 == 0)
+            {
+                if (coordinate.z != l - 1)
                 {
-                    if (coordinate.x == l - 1)
-                    {
-                        continue;
-                    }
-                    addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
+                    addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {1, 1, 1, 1});
                     ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {1, 1, 1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xy", "xz", "xz", "xy"}, {1, -1, -1, 1});
+                    addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {-1, 1, 1, -1});
                     ++faceIndex;
                 }
-                else if (coordinate.x == l - 1)
+                if (coordinate.z != 1)
                 {
-                    addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {-1, -1, -1, -1});
+                    addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {1, -1, -1, 1});
+                    ++faceIndex;
+                    addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {-1, -1, -1, -1});
                     ++faceIndex;
                 }
-                else if (coordinate.y == l - 1)
+                addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {-1, -1, -1, -1});
+                ++faceIndex;
+            }
+            else if (coordinate.x % 2 == 1 && coordinate.y % 2 == 1)
+            {
+                if (coordinate.z != l - 1)
                 {
-                    addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xy", "xz", "xz", "xy"}, {-1, 1, 1, -1});
+                    addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {1, 1, 1, 1});
                     ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {-1, -1, -1, -1});
+                    addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {-1, 1, 1, -1});
                     ++faceIndex;
                 }
-                else if (coordinate.x % 2 == 0 && coordinate.y % 2 == 1)
+                if (coordinate.z != 1)
                 {
-                    addFace(vertexIndex, faceIndex, {"xz", "xy", "xy", "xz"}, {1, -1, -1, 1});
+                    addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"}, {1, -1, -1, 1});
                     ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {-1, -1, -1, -1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {1, 1, 1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xz", "xy", "xy", "xz"}, {-1, 1, 1, -1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {-1, 1, 1, -1});
+                    addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"}, {-1, -1, -1, -1});
                     ++faceIndex;
                 }
-                else if (coordinate.x % 2 == 1 && coordinate.y % 2 == 0)
+                addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {-1, 1, 1, -1});
+                ++faceIndex;
+            }
+        }
+        else
+        {
+            if (coordinate.x == 0)
+            {
+                addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
+                ++faceIndex;
+            }
+            else if (coordinate.y == 0)
+            {
+                if (coordinate.x == l - 1)
                 {
-                    addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {1, 1, 1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xz", "xy", "xy", "xz"}, {-1, 1, 1, -1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xz", "xy", "xy", "xz"}, {1, -1, -1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {-1, -1, -1, -1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
-                    ++faceIndex;
-                    addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {-1, -1, -1, -1});
-                    ++faceIndex;
+                    continue;
                 }
+                addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {1, 1, 1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xy", "xz", "xz", "xy"}, {1, -1, -1, 1});
+                ++faceIndex;
+            }
+            else if (coordinate.x == l - 1)
+            {
+                addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {-1, -1, -1, -1});
+                ++faceIndex;
+            }
+            else if (coordinate.y == l - 1)
+            {
+                addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xy", "xz", "xz", "xy"}, {-1, 1, 1, -1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {-1, -1, -1, -1});
+                ++faceIndex;
+            }
+            else if (coordinate.x % 2 == 0 && coordinate.y % 2 == 1)
+            {
+                addFace(vertexIndex, faceIndex, {"xz", "xy", "xy", "xz"}, {1, -1, -1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {-1, -1, -1, -1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {1, 1, 1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xz", "xy", "xy", "xz"}, {-1, 1, 1, -1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {1, -1, -1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"}, {-1, 1, 1, -1});
+                ++faceIndex;
+            }
+            else if (coordinate.x % 2 == 1 && coordinate.y % 2 == 0)
+            {
+                addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {1, 1, 1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xz", "xy", "xy", "xz"}, {-1, 1, 1, -1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xz", "xy", "xy", "xz"}, {1, -1, -1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"}, {-1, -1, -1, -1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {1, 1, 1, 1});
+                ++faceIndex;
+                addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"}, {-1, -1, -1, -1});
+                ++faceIndex;
             }
         }
     }
+    indexFaces();
 }
 
 void RhombicLattice::createUpEdgesMap()
@@ -300,264 +284,68 @@ void RhombicLattice::createUpEdgesMap()
     for (const auto &direction : directionList)
     {
         vvint vertexToUpEdges;
-        vertexToUpEdges.assign(2 * l * l * l, {});
-        for (int vertexIndex = 0; vertexIndex < 2 * l * l * l; ++vertexIndex)
+        vertexToUpEdges.assign(numberOfVertices, {});
+        for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex)
         {
             cartesian4 coordinate = indexToCoordinate(vertexIndex);
             if (coordinate.w == 0)
             {
-                if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 1)
+                if (direction == "xyz")
                 {
-                    if (direction == "xyz")
-                    {
-                        // Third argument is sign
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                            // Edge includes vertex outside lattice
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                    }
-                    else if (direction == "yz")
-                    {
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                    }
-                    else if (direction == "xz")
-                    {
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                    }
-                    else if (direction == "xy")
-                    {
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                    }
-                    else if (direction == "-xyz")
-                    {
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                    }
-                    else if (direction == "-yz")
-                    {
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                        }
-                        catch (const std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                    }
-                    else if (direction == "-xz")
-                    {
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                    }
-                    else if (direction == "-xy")
-                    {
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                        try
-                        {
-                            vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                        }
-                        catch (std::invalid_argument &e)
-                        {
-                        }
-                    }
+                    // Third argument is sign
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, 1});
+                }
+                else if (direction == "yz")
+                {
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, -1});
+                }
+                else if (direction == "xz")
+                {
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, -1});
+                }
+                else if (direction == "xy")
+                {
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, -1});
+                }
+                else if (direction == "-xyz")
+                {
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, -1});
+                }
+                else if (direction == "-yz")
+                {
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, -1});
+                }
+                else if (direction == "-xz")
+                {
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, -1});
+                }
+                else if (direction == "-xy")
+                {
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, 1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, -1});
+                    addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, -1});
                 }
             }
             else
@@ -572,99 +360,27 @@ void RhombicLattice::createUpEdgesMap()
                     {
                         if (direction == "xyz")
                         {
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, 1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, 1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, 1});
                         }
                         else if (direction == "-xy")
                         {
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, -1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, 1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, 1});
                         }
                         else if (direction == "-xz")
                         {
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, -1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, 1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, 1});
                         }
                         else if (direction == "-yz")
                         {
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, -1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, 1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, 1});
                         }
                     }
                 }
@@ -678,245 +394,77 @@ void RhombicLattice::createUpEdgesMap()
                     {
                         if (direction == "-xyz")
                         {
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, -1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, -1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, -1});
                         }
                         else if (direction == "xy")
                         {
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, 1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, -1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, -1});
                         }
                         else if (direction == "xz")
                         {
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, 1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, -1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::yz, -1});
                         }
                         else if (direction == "yz")
                         {
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
-                            try
-                            {
-                                vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                            }
-                            catch (std::invalid_argument &e)
-                            {
-                            }
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xyz, 1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xz, -1});
+                            addEdge(vertexToUpEdges[vertexIndex], vertexIndex, {Direction::xy, -1});
                         }
                     }
                 }
             }
         }
-        upEdgesMap.insert(std::pair<std::string, vvint>(direction, vertexToUpEdges));
+        addUpEdges(direction, vertexToUpEdges);
     }
 }
 
 void RhombicLattice::createVertexToEdges()
 {
-    for (int vertexIndex = 0; vertexIndex < 2 * l * l * l; ++vertexIndex)
+    vvint edges(numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex)
     {
         cartesian4 coordinate = indexToCoordinate(vertexIndex);
         if (coordinate.w == 0)
         {
-            if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 1)
-            {
-                int sign = 1;
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                sign = -1;
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-            }
+            int sign = 1;
+            addEdge(edges[vertexIndex], vertexIndex, {Direction::xyz, sign});
+            addEdge(edges[vertexIndex], vertexIndex, {Direction::xy, sign});
+            addEdge(edges[vertexIndex], vertexIndex, {Direction::xz, sign});
+            addEdge(edges[vertexIndex], vertexIndex, {Direction::yz, sign});
+            sign = -1;
+            addEdge(edges[vertexIndex], vertexIndex, {Direction::xyz, sign});
+            addEdge(edges[vertexIndex], vertexIndex, {Direction::xy, sign});
+            addEdge(edges[vertexIndex], vertexIndex, {Direction::xz, sign});
+            addEdge(edges[vertexIndex], vertexIndex, {Direction::yz, sign});
         }
         else
         {
             if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 1)
             {
                 int sign = 1;
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
+                addEdge(edges[vertexIndex], vertexIndex, {Direction::xy, sign});
+                addEdge(edges[vertexIndex], vertexIndex, {Direction::xz, sign});
+                addEdge(edges[vertexIndex], vertexIndex, {Direction::yz, sign});
                 sign = -1;
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
+                addEdge(edges[vertexIndex], vertexIndex, {Direction::xyz, sign});
             }
             else
             {
                 int sign = -1;
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
+                addEdge(edges[vertexIndex], vertexIndex, {Direction::xy, sign});
+                addEdge(edges[vertexIndex], vertexIndex, {Direction::xz, sign});
+                addEdge(edges[vertexIndex], vertexIndex, {Direction::yz, sign});
                 sign = 1;
-                try
-                {
-                    vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
-                }
-                catch (std::invalid_argument &e)
-                {
-                }
+                addEdge(edges[vertexIndex], vertexIndex, {Direction::xyz, sign});
             }
         }
     }
+    vertexToEdges = FlatLists<int>(edges);
+    indexEdges();
 }
\ No newline at end of file
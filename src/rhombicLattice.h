@@ -12,7 +12,7 @@ class RhombicLattice : public Lattice
 
   public:
     RhombicLattice(const int l);
-    int neighbour(const int vertexIndex, const std::string &direction, const int sign);
+    int computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const;
     void createFaces();
     void createVertexToEdges();
     void createUpEdgesMap();
@@ -14,56 +14,58 @@ RhombicToricLattice::RhombicToricLattice(const int length) : Lattice(length)
     }
     faceToVertices.reserve(3 * l * l * l);
     faceToEdges.reserve(3 * l * l * l);
-    // Not all vertices present in this lattice, but all w=1 faces
-    // are present, so the possible vertex indices go from
-    // 0 to l^3 -1
-    vertexToFaces.assign(2 * l * l * l, {});
-    vertexToEdges.assign(2 * l * l * l, {});
+    // Only the even sites of the w = 0 sub-lattice hold a vertex, so there
+    // are l^3 / 2 of them followed by the l^3 vertices of the w = 1 sub-lattice
+    numberVertices(2, 0);
+    createNeighbours({Direction::xyz, Direction::xy, Direction::xz, Direction::yz});
+    // Every edge has one end on the w = 0 sub-lattice, which numbers eight
+    numberEdges({Direction::xyz, Direction::xy, Direction::xz, Direction::yz,
+                 -Direction::xyz, -Direction::xy, -Direction::xz, -Direction::yz});
 }
 
-int RhombicToricLattice::neighbour(const int vertexIndex, const std::string &direction, const int sign)
+int RhombicToricLattice::computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const
 {
     if (!(sign == 1 || sign == -1))
     {
         throw std::invalid_argument("Sign must be either 1 or -1.");
     }
-    if (!(direction == "xy" || direction == "xz" || direction == "yz" ||
-          direction == "xyz"))
+    if (!(direction == Direction::xy || direction == Direction::xz || direction == Direction::yz ||
+          direction == Direction::xyz))
     {
         throw std::invalid_argument("Direction must be one of 'xy', 'xz', 'yz' or 'xyz'.");
     }
     cartesian4 coordinate;
     coordinate = indexToCoordinate(vertexIndex);
-    // if (direction == "x")
+    // if (direction == Direction::x)
     //     coordinate.x = (coordinate.x + sign + l) % l;
-    // if (direction == "y")
+    // if (direction == Direction::y)
     //     coordinate.y = (coordinate.y + sign + l) % l;
-    // if (direction == "z")
+    // if (direction == Direction::z)
     //     coordinate.z = (coordinate.z + sign + l) % l;
     if (coordinate.w == 1)
     {
-        if (direction == "xy")
+        if (direction == Direction::xy)
         {
             coordinate.x = (coordinate.x + (sign > 0)) % l;
             coordinate.y = (coordinate.y + (sign > 0)) % l;
             coordinate.z = (coordinate.z + (sign < 0)) % l;
             coordinate.w = 0;
         }
-        if (direction == "xz")
+        if (direction == Direction::xz)
         {
             coordinate.x = (coordinate.x + (sign > 0)) % l;
             coordinate.z = (coordinate.z + (sign > 0)) % l;
             coordinate.y = (coordinate.y + (sign < 0)) % l;
             coordinate.w = 0;
         }
-        if (direction == "yz")
+        if (direction == Direction::yz)
         {
             coordinate.y = (coordinate.y + (sign > 0)) % l;
             coordinate.z = (coordinate.z + (sign > 0)) % l;
             coordinate.x = (coordinate.x + (sign < 0)) % l;
             coordinate.w = 0;
         }
-        if (direction == "xyz")
+        if (direction == Direction::xyz)
         {
             coordinate.x = (coordinate.x + (sign > 0)) % l;
             coordinate.y = (coordinate.y + (sign > 0)) % l;
@@ -73,28 +75,28 @@ int RhombicToricLattice::neighbour(const int vertexIndex, const std::string &dir
     }
     else
     {
-        if (direction == "xy")
+        if (direction == Direction::xy)
         {
             coordinate.x = (coordinate.x - (sign < 0) + l) % l;
             coordinate.y = (coordinate.y - (sign < 0) + l) % l;
             coordinate.z = (coordinate.z - (sign > 0) + l) % l;
             coordinate.w = 1;
         }
-        if (direction == "xz")
+        if (direction == Direction::xz)
         {
             coordinate.x = (coordinate.x - (sign < 0) + l) % l;
             coordinate.z = (coordinate.z - (sign < 0) + l) % l;
             coordinate.y = (coordinate.y - (sign > 0) + l) % l;
             coordinate.w = 1;
         }
-        if (direction == "yz")
+        if (direction == Direction::yz)
         {
             coordinate.y = (coordinate.y - (sign < 0) + l) % l;
             coordinate.z = (coordinate.z - (sign < 0) + l) % l;
             coordinate.x = (coordinate.x - (sign > 0) + l) % l;
             coordinate.w = 1;
         }
-        if (direction == "xyz")
+        if (direction == Direction::xyz)
         {
             coordinate.x = (coordinate.x - (sign < 0) + l) % l;
             coordinate.y = (coordinate.y - (sign < 0) + l) % l;
@@ -108,33 +110,30 @@ int RhombicToricLattice::neighbour(const int vertexIndex, const std::string &dir
 void RhombicToricLattice::createFaces()
 {
     int faceIndex = 0;
-    for (int vertexIndex = 0; vertexIndex < l * l * l; ++vertexIndex)
+    for (int vertexIndex = 0; vertexIndex < numberOfW0Vertices; ++vertexIndex)
     {
-        cartesian4 coordinate = indexToCoordinate(vertexIndex);
-        if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
-        {
-            vint signs = {1, 1, 1, 1};
-            addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"},
-                    signs);
-            ++faceIndex;
-            addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"},
-                    signs);
-            ++faceIndex;
-            addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"},
-                    signs);
-            ++faceIndex;
-            signs = {1, -1, -1, 1};
-            addFace(vertexIndex, faceIndex, {"xy", "xz", "xz", "xy"},
-                    signs);
-            ++faceIndex;
-            addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"},
-                    signs);
-            ++faceIndex;
-            addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"},
-                    signs);
-            ++faceIndex;
-        }
+        vint signs = {1, 1, 1, 1};
+        addFace(vertexIndex, faceIndex, {"xyz", "yz", "yz", "xyz"},
+                signs);
+        ++faceIndex;
+        addFace(vertexIndex, faceIndex, {"xyz", "xz", "xz", "xyz"},
+                signs);
+        ++faceIndex;
+        addFace(vertexIndex, faceIndex, {"xyz", "xy", "xy", "xyz"},
+                signs);
+        ++faceIndex;
+        signs = {1, -1, -1, 1};
+        addFace(vertexIndex, faceIndex, {"xy", "xz", "xz", "xy"},
+                signs);
+        ++faceIndex;
+        addFace(vertexIndex, faceIndex, {"xy", "yz", "yz", "xy"},
+                signs);
+        ++faceIndex;
+        addFace(vertexIndex, faceIndex, {"xz", "yz", "yz", "xz"},
+                signs);
+        ++faceIndex;
     }
+    indexFaces();
 }
 
 void RhombicToricLattice::createUpEdgesMap()
@@ -144,71 +143,68 @@ void RhombicToricLattice::createUpEdgesMap()
     for (const auto &direction : directionList)
     {
         vvint vertexToUpEdges;
-        vertexToUpEdges.assign(2 * l * l * l, {});
-        for (int vertexIndex = 0; vertexIndex < 2 * l * l * l; ++vertexIndex)
+        vertexToUpEdges.assign(numberOfVertices, {});
+        for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex)
         {
             cartesian4 coordinate = indexToCoordinate(vertexIndex);
             if (coordinate.w == 0)
             {
-                if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
+                if (direction == "xyz")
                 {
-                    if (direction == "xyz")
-                    {
-                        // Third argument is sign
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                    }
-                    else if (direction == "yz")
-                    {
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                    }
-                    else if (direction == "xz")
-                    {
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                    }
-                    else if (direction == "xy")
-                    {
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                    }
-                    else if (direction == "-xyz")
-                    {
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                    }
-                    else if (direction == "-yz")
-                    {
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
-                    }
-                    else if (direction == "-xz")
-                    {
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
-                    }
-                    else if (direction == "-xy")
-                    {
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
-                        vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
-                    }
+                    // Third argument is sign
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
+                }
+                else if (direction == "yz")
+                {
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
+                }
+                else if (direction == "xz")
+                {
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
+                }
+                else if (direction == "xy")
+                {
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
+                }
+                else if (direction == "-xyz")
+                {
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
+                }
+                else if (direction == "-yz")
+                {
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", -1));
+                }
+                else if (direction == "-xz")
+                {
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", -1));
+                }
+                else if (direction == "-xy")
+                {
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", 1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", -1));
+                    vertexToUpEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", -1));
                 }
             }
             else
@@ -283,51 +279,51 @@ void RhombicToricLattice::createUpEdgesMap()
                 }
             }
         }
-        upEdgesMap.insert(std::pair<std::string, vvint>(direction, vertexToUpEdges));
+        addUpEdges(direction, vertexToUpEdges);
     }
 }
 
 void RhombicToricLattice::createVertexToEdges()
 {
-    for (int vertexIndex = 0; vertexIndex < 2 * l * l * l; ++vertexIndex)
+    vvint edges(numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex)
     {
         cartesian4 coordinate = indexToCoordinate(vertexIndex);
         if (coordinate.w == 0)
         {
-            if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
-            {
-                int sign = 1;
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
-                sign = -1;
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
-            }
+            int sign = 1;
+            edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
+            edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
+            edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
+            edges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
+            sign = -1;
+            edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
+            edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
+            edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
+            edges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
         }
         else
         {
             if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
             {
                 int sign = 1;
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
+                edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
+                edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
+                edges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
                 sign = -1;
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
+                edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
             }
             else
             {
                 int sign = -1;
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
+                edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xy", sign));
+                edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xz", sign));
+                edges[vertexIndex].push_back(edgeIndex(vertexIndex, "yz", sign));
                 sign = 1;
-                vertexToEdges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
+                edges[vertexIndex].push_back(edgeIndex(vertexIndex, "xyz", sign));
             }
         }
     }
+    vertexToEdges = FlatLists<int>(edges);
+    indexEdges();
 }
\ No newline at end of file
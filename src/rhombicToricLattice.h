@@ -13,7 +13,7 @@ class RhombicToricLattice : public Lattice
   public:
     RhombicToricLattice(const int l);
     RhombicToricLattice();
-    int neighbour(const int vertexIndex, const std::string &direction, const int sign);
+    int computeNeighbour(const int vertexIndex, const Direction direction, const int sign) const;
     void createFaces();
     void createVertexToEdges();
     void createUpEdgesMap();
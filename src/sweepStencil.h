@@ -0,0 +1,71 @@
+#ifndef SWEEP_STENCIL_H
+#define SWEEP_STENCIL_H
+
+#include "lattice.h"
+#include <cstdint>
+
+// The sweep rule of a toric code as a stencil. Vertices of one type (sub-
+// lattice w and parity of x + y + z) share a rule class, and the edges and
+// faces the rule uses sit at the same offsets from each of them, so they are
+// computed from the coordinates of the vertex instead of per-vertex tables.
+// Empty for codes which are not translation invariant.
+struct SweepStencil
+{
+  // A vertex of the w = 0 sub-lattice at (dx, dy, dz) from the swept vertex,
+  // and the slot of the edge it owns or the type of the face it is the base of
+  struct Offset
+  {
+    int8_t x;
+    int8_t y;
+    int8_t z;
+    int8_t k;
+
+    bool operator==(const Offset &other) const
+    {
+      return x == other.x && y == other.y && z == other.z && k == other.k;
+    }
+  };
+
+  int l = 0;
+  // The w = 0 vertex at site x + l * (y + l * z) is index site >> siteShift,
+  // and owns edgesPerOwner edges and is the base of facesPerBase faces
+  int siteShift = 0;
+  int edgesPerOwner = 0;
+  int facesPerBase = 0;
+  vint wrap; // wrap[i + 1] is i modulo l for i from -1 to l, a halo around the lattice
+  vint typeClass; // rule class of each vertex type (2 * w + parity), -1 if never swept
+  FlatLists<Offset> upEdges; // [type][direction index], in the order of Lattice::getUpEdges
+  FlatLists<Offset> otherEdges; // [type][direction index], the remaining edges of the vertex
+  FlatLists<Offset> faces; // [type], one per slot of its class
+
+  bool empty() const { return typeClass.empty(); }
+  static int type(const cartesian4 &coordinate) { return 2 * coordinate.w + ((coordinate.x + coordinate.y + coordinate.z) & 1); }
+  int w0Vertex(const cartesian4 &coordinate, const Offset &offset) const
+  {
+    return (wrap[coordinate.x + offset.x + 1] + l * (wrap[coordinate.y + offset.y + 1] + l * wrap[coordinate.z + offset.z + 1])) >> siteShift;
+  }
+  int edge(const cartesian4 &coordinate, const Offset &offset) const
+  {
+    return edgesPerOwner * w0Vertex(coordinate, offset) + offset.k;
+  }
+  int face(const cartesian4 &coordinate, const Offset &offset) const
+  {
+    return facesPerBase * w0Vertex(coordinate, offset) + offset.k;
+  }
+  // See Lattice::transferTables
+  template <typename Tables>
+  void transferTables(Tables &tables)
+  {
+    tables(l);
+    tables(siteShift);
+    tables(edgesPerOwner);
+    tables(facesPerBase);
+    tables(wrap);
+    tables(typeClass);
+    upEdges.transferTables(tables);
+    otherEdges.transferTables(tables);
+    faces.transferTables(tables);
+  }
+};
+
+#endif
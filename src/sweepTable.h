@@ -0,0 +1,53 @@
+#ifndef SWEEP_TABLE_H
+#define SWEEP_TABLE_H
+
+#include "lattice.h"
+#include <cstdint>
+
+// The sweep rule of a code as lookup tables, recorded once per geometry.
+// A decision is stored for every sweep vertex, sweep direction and syndrome
+// on the up-edges of the vertex (bit i of the mask is up-edge i). Vertices on
+// which the rule makes the same decisions share a rule class, and the faces a
+// class flips are slots which each vertex maps to its own face indices.
+struct SweepTable
+{
+  static const int numberOfMasks = 16; // at most four up-edges
+
+  struct Decision
+  {
+    // 1 flips one set of faces, 2 or 3 flip one of that many sets picked at
+    // random and 0 means the rule is too irregular to record so it is run
+    int8_t options;
+    // Offset in slots, where each option is a count followed by the slots
+    int begin;
+  };
+
+  TableArray<int> vertexClass; // -1 for vertices which are never swept
+  std::vector<Decision> decisions; // [class][direction index][mask]
+  std::vector<int8_t> slots;
+  TableArray<int> vertexFacesBegin; // offset of the slot faces of each vertex
+  TableArray<int> vertexFaces; // face index of each slot, -1 if the face is missing
+  // vertexClass, vertexFacesBegin and vertexFaces are empty for codes swept
+  // with a stencil, see CodeGeometry::sweepClass and slotFace
+
+  const Decision &decision(const int vertexIndex, const SignedDirection &direction, const int mask) const
+  {
+    return classDecision(vertexClass[vertexIndex], direction, mask);
+  }
+  const Decision &classDecision(const int ruleClass, const SignedDirection &direction, const int mask) const
+  {
+    return decisions[(ruleClass * 14 + direction.index()) * numberOfMasks + mask];
+  }
+  // See Lattice::transferTables
+  template <typename Tables>
+  void transferTables(Tables &tables)
+  {
+    tables(vertexClass);
+    tables(decisions);
+    tables(slots);
+    tables(vertexFacesBegin);
+    tables(vertexFaces);
+  }
+};
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef TABLE_ARRAY_H
+#define TABLE_ARRAY_H
+
+#include <memory>
+#include <vector>
+
+// An array of table values which either owns them or is a read-only view of
+// values kept alive by a shared source, such as a file mapped by
+// GeometryCache. A view is copied into owned storage the first time it is
+// changed, so only the tables which are built are ever written.
+template <typename T>
+class TableArray
+{
+public:
+  typedef const T *const_iterator;
+  typedef T value_type;
+
+  TableArray() {}
+  TableArray(const size_t count, const T &value) : items(count, value) { point(); }
+  explicit TableArray(std::vector<T> values) : items(std::move(values)) { point(); }
+  TableArray(const T *values, const size_t count, std::shared_ptr<const void> source)
+      : first(values), length(count), source(std::move(source)) {}
+  TableArray(const TableArray &other) : items(other.items), first(other.first), length(other.length), source(other.source)
+  {
+    if (!source)
+    {
+      point();
+    }
+  }
+  // Moving a vector keeps its storage, so first stays valid
+  TableArray(TableArray &&other) noexcept
+      : items(std::move(other.items)), first(other.first), length(other.length), source(std::move(other.source))
+  {
+    other.point();
+  }
+  TableArray &operator=(TableArray other) noexcept
+  {
+    items.swap(other.items);
+    std::swap(first, other.first);
+    std::swap(length, other.length);
+    source.swap(other.source);
+    return *this;
+  }
+
+  size_t size() const { return length; }
+  bool empty() const { return length == 0; }
+  const T *data() const { return first; }
+  const T *begin() const { return first; }
+  const T *end() const { return first + length; }
+  const T &operator[](const size_t i) const { return first[i]; }
+  T &operator[](const size_t i)
+  {
+    own();
+    return items[i];
+  }
+  const T &back() const { return first[length - 1]; }
+  T &back()
+  {
+    own();
+    return items.back();
+  }
+  void push_back(const T &value)
+  {
+    own();
+    items.push_back(value);
+    point();
+  }
+  template <typename Iterator>
+  void append(const Iterator begin, const Iterator end)
+  {
+    own();
+    items.insert(items.end(), begin, end);
+    point();
+  }
+  void reserve(const size_t count)
+  {
+    own();
+    items.reserve(count);
+    point();
+  }
+  void assign(const size_t count, const T &value)
+  {
+    source.reset();
+    items.assign(count, value);
+    point();
+  }
+  // True if the values are not owned but viewed in their source
+  bool isView() const { return source != nullptr; }
+
+private:
+  std::vector<T> items; // empty for a view
+  const T *first = nullptr;
+  size_t length = 0;
+  std::shared_ptr<const void> source; // nullptr if the values are owned
+
+  void point()
+  {
+    first = items.data();
+    length = items.size();
+  }
+  void own()
+  {
+    if (source)
+    {
+      items.assign(first, first + length);
+      source.reset();
+      point();
+    }
+  }
+};
+
+#endif
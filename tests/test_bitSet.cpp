@@ -0,0 +1,48 @@
+#include "bitSet.h"
+#include "gtest/gtest.h"
+#include <set>
+
+TEST(BitSet, behaves_like_set)
+{
+    BitSet bits(130);
+    std::set<int> expected = {0, 5, 63, 64, 100, 129};
+    for (const int i : expected)
+    {
+        bits.insert(i);
+    }
+    EXPECT_EQ(bits.size(), expected.size());
+    EXPECT_EQ(bits.toSet(), expected);
+    EXPECT_TRUE(bits.find(63) != bits.end());
+    EXPECT_TRUE(bits.find(62) == bits.end());
+    bits.erase(63);
+    expected.erase(63);
+    EXPECT_EQ(bits.toSet(), expected);
+    bits.clear();
+    EXPECT_TRUE(bits.empty());
+    EXPECT_TRUE(bits.begin() == bits.end());
+}
+
+TEST(toggle, flips_bits)
+{
+    BitSet bits(70);
+    bits.toggle(3);
+    bits.toggle(69);
+    EXPECT_EQ(bits.toSet(), std::set<int>({3, 69}));
+    bits.toggle(3);
+    EXPECT_EQ(bits.toSet(), std::set<int>({69}));
+}
+
+TEST(parity, counts_overlap_mod_two)
+{
+    BitSet bits(200), mask(200);
+    for (const int i : {1, 70, 150, 199})
+    {
+        mask.insert(i);
+    }
+    EXPECT_EQ(bits.parity(mask), 0);
+    bits.insert(70);
+    bits.insert(2);
+    EXPECT_EQ(bits.parity(mask), 1);
+    bits.insert(199);
+    EXPECT_EQ(bits.parity(mask), 0);
+}
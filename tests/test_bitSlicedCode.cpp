@@ -0,0 +1,198 @@
+#include "bitSlicedCode.h"
+#include "rhombicCode.h"
+#include "cubicCode.h"
+#include "gtest/gtest.h"
+#include <set>
+
+TEST(calculateSyndrome, matches_code_in_every_lane)
+{
+    auto geometry = RhombicCode::buildGeometry(6, true);
+    RhombicCode code(geometry, 0.1, 0, 1);
+    BitSlicedCode bitSlicedCode(geometry, 0.1, 0);
+    std::vector<BitVector> syndromes;
+    for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+    {
+        code.reset();
+        code.generateDataError(false);
+        code.calculateSyndrome();
+        bitSlicedCode.setError(lane, code.getError().toSet());
+        syndromes.push_back(code.getSyndrome());
+    }
+    bitSlicedCode.calculateSyndrome();
+    for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+    {
+        EXPECT_EQ(bitSlicedCode.getSyndrome(lane), syndromes[lane]);
+    }
+}
+
+TEST(generateDataError, syndrome_follows_error)
+{
+    auto geometry = CubicCode::buildGeometry(6, false);
+    BitSlicedCode code(geometry, 0.05, 0.05);
+    BitSlicedCode expected(geometry, 0.05, 0.05);
+    code.generateDataError(false);
+    code.generateMeasError();
+    code.sweep(Direction::xyz, true);
+    code.updateSyndrome();
+    for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+    {
+        expected.setError(lane, code.getError(lane));
+    }
+    expected.calculateSyndrome();
+    for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+    {
+        EXPECT_EQ(code.getSyndrome(lane), expected.getSyndrome(lane));
+    }
+}
+
+TEST(generateDataError, statistics_correct)
+{
+    double p = 0.2;
+    double tolerance = 0.05;
+    auto geometry = RhombicCode::buildGeometry(4, false);
+    BitSlicedCode code(geometry, p, 0);
+    code.generateDataError(false);
+    int errorCount = 0;
+    for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+    {
+        errorCount += code.getError(lane).size();
+    }
+    double expectedCount = geometry->numberOfFaces * BitSlicedCode::numberOfLanes * p;
+    EXPECT_NEAR(errorCount, expectedCount, expectedCount * tolerance);
+}
+
+TEST(sweep, corrects_single_qubit_errors_in_every_lane)
+{
+    auto geometry = RhombicCode::buildGeometry(4, true);
+    vdir sweepDirections = {Direction::xyz, Direction::xy, Direction::yz, Direction::xz,
+                            -Direction::xyz, -Direction::xy, -Direction::yz, -Direction::xz};
+    BitSlicedCode code(geometry, 0, 0);
+    for (int first = 0; first < geometry->numberOfFaces; first += BitSlicedCode::numberOfLanes)
+    {
+        for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+        {
+            std::set<int> error;
+            if (first + lane < geometry->numberOfFaces)
+            {
+                error.insert(first + lane);
+            }
+            code.setError(lane, error);
+        }
+        code.calculateSyndrome();
+        for (auto &sweepDirection : sweepDirections)
+        {
+            code.sweep(sweepDirection, true);
+        }
+        EXPECT_EQ(code.unsatisfiedLanes(), 0);
+    }
+}
+
+// Whether every decision of the sweep rule which a sweep of this syndrome
+// can reach has a single option, so that the sweep makes no random choice
+bool deterministicSweep(const CodeGeometry &geometry, const BitVector &syndrome, const SignedDirection &direction)
+{
+    for (const int vertexIndex : geometry.sweepIndices)
+    {
+        auto upEdges = geometry.lattice->getUpEdges(vertexIndex, direction);
+        int mask = 0;
+        for (int i = 0, imax = upEdges.size(); i < imax; ++i)
+        {
+            mask |= syndrome[upEdges[i]] << i;
+        }
+        if (mask != 0 && geometry.sweepTable.classDecision(geometry.sweepClass(vertexIndex), direction, mask).options != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Sweeps a random error in every lane and compares each lane with code
+// sweeping the same error, wherever the sweep makes no random choice
+void expectSweepsMatchCode(std::shared_ptr<const CodeGeometry> geometry, Code &code)
+{
+    vdir sweepDirections = {Direction::xyz, Direction::xy, Direction::yz, Direction::xz,
+                            -Direction::xyz, -Direction::xy, -Direction::yz, -Direction::xz};
+    BitSlicedCode bitSlicedCode(geometry, 0, 0);
+    int compared = 0;
+    for (const bool greedy : {true, false})
+    {
+        for (auto &direction : sweepDirections)
+        {
+            std::vector<std::set<int>> expected;
+            uint64_t deterministic = 0;
+            for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+            {
+                code.reset();
+                code.generateDataError(false);
+                code.calculateSyndrome();
+                bitSlicedCode.setError(lane, code.getError().toSet());
+                if (deterministicSweep(*geometry, code.getSyndrome(), direction))
+                {
+                    deterministic |= uint64_t(1) << lane;
+                }
+                code.sweep(direction, greedy);
+                expected.push_back(code.getError().toSet());
+            }
+            bitSlicedCode.calculateSyndrome();
+            bitSlicedCode.sweep(direction, greedy);
+            for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+            {
+                if ((deterministic >> lane) & 1)
+                {
+                    EXPECT_EQ(bitSlicedCode.getError(lane), expected[lane]);
+                    ++compared;
+                }
+            }
+        }
+    }
+    // Most of the errors are swept without random choices
+    EXPECT_GT(compared, 2 * 8 * BitSlicedCode::numberOfLanes / 2);
+}
+
+TEST(sweep, matches_code_in_every_lane)
+{
+    auto rhombicGeometry = RhombicCode::buildGeometry(6, true);
+    RhombicCode rhombicCode(rhombicGeometry, 0.02, 0, 1);
+    rhombicCode.setSeed(1, 0);
+    expectSweepsMatchCode(rhombicGeometry, rhombicCode);
+    auto cubicGeometry = CubicCode::buildGeometry(6, false);
+    CubicCode cubicCode(cubicGeometry, 0.02, 0, 1);
+    cubicCode.setSeed(2, 0);
+    expectSweepsMatchCode(cubicGeometry, cubicCode);
+}
+
+TEST(sweep, sweeps_only_the_given_lanes)
+{
+    auto geometry = RhombicCode::buildGeometry(6, false);
+    BitSlicedCode code(geometry, 0.05, 0);
+    code.setSeed(3, 0);
+    code.generateDataError(false);
+    std::vector<std::set<int>> before;
+    for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+    {
+        before.push_back(code.getError(lane));
+    }
+    const uint64_t evenLanes = 0x5555555555555555;
+    code.sweep(Direction::xyz, false, evenLanes);
+    int changed = 0;
+    for (int lane = 0; lane < BitSlicedCode::numberOfLanes; ++lane)
+    {
+        if ((evenLanes >> lane) & 1)
+        {
+            changed += code.getError(lane) != before[lane];
+        }
+        else
+        {
+            EXPECT_EQ(code.getError(lane), before[lane]);
+        }
+    }
+    EXPECT_GT(changed, 0);
+}
+
+TEST(sweep, invalid_direction_throws_exception)
+{
+    auto geometry = CubicCode::buildGeometry(4, false);
+    BitSlicedCode code(geometry, 0.1, 0);
+    EXPECT_THROW(code.sweep(Direction::x, true), std::invalid_argument);
+}
@@ -0,0 +1,64 @@
+#include "bitVector.h"
+#include "gtest/gtest.h"
+#include <vector>
+#include "pcg_random.hpp"
+
+TEST(BitVector, matches_int8_vector)
+{
+    std::vector<int8_t> values(150, 0);
+    values[0] = 1;
+    values[64] = 1;
+    values[149] = 1;
+    BitVector bits(values);
+    EXPECT_EQ(bits.size(), 150);
+    EXPECT_EQ(bits.count(), 3);
+    for (int i = 0; i < bits.size(); ++i)
+    {
+        EXPECT_EQ(bits[i], values[i]);
+    }
+    int i = 0;
+    for (auto value : bits)
+    {
+        EXPECT_EQ(value, values[i++]);
+    }
+    EXPECT_EQ(i, 150);
+}
+
+TEST(toggle, flips_values)
+{
+    BitVector bits(100);
+    EXPECT_FALSE(bits.any());
+    bits.toggle(99);
+    EXPECT_EQ(bits[99], 1);
+    EXPECT_TRUE(bits.any());
+    bits.toggle(99);
+    EXPECT_EQ(bits[99], 0);
+    EXPECT_FALSE(bits.any());
+}
+
+TEST(next, finds_ones_in_order)
+{
+    BitVector bits(200);
+    bits.set(3);
+    bits.set(64);
+    bits.set(190);
+    EXPECT_EQ(bits.next(0), 3);
+    EXPECT_EQ(bits.next(4), 64);
+    EXPECT_EQ(bits.next(65), 190);
+    EXPECT_EQ(bits.next(191), 200);
+    bits.clear();
+    EXPECT_EQ(bits.next(0), 200);
+    EXPECT_EQ(bits.size(), 200);
+}
+
+TEST(setRandom, sets_values_with_threshold_probability)
+{
+    pcg32 rnEngine(0);
+    BitVector bits(100000);
+    bits.setRandom(rnEngine, 0);
+    EXPECT_FALSE(bits.any());
+    bits.setRandom(rnEngine, uint64_t(1) << 32);
+    EXPECT_EQ(bits.count(), 100000);
+    bits.setRandom(rnEngine, uint64_t(1) << 30);
+    EXPECT_NEAR(bits.count(), 25000, 500);
+}
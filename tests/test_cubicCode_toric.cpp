@@ -24,12 +24,12 @@ TEST(edgeIndex, handles_valid_input)
     CubicToricLattice lattice = CubicToricLattice(l);
     int vertexIndex = 0;
     int sign = 1;
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "x", sign), 1);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "y", sign), 3);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "z", sign), 5);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "x", -sign), 29);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "y", -sign), 143);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "z", -sign), 705);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "x", sign), 0);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "y", sign), 1);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "z", sign), 2);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "x", -sign), 12);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "y", -sign), 61);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "z", -sign), 302);
 }
 
 TEST(generateDataError, statistics_correct)
@@ -43,6 +43,24 @@ TEST(generateDataError, statistics_correct)
     EXPECT_NEAR(pow(l, 3) * 3 * p, errorCount, pow(l, 3) * 3 * p * tolerance);
 }
 
+TEST(generateDataError, statistics_correct_for_small_probability)
+{
+    double p = 0.01;
+    int l = 24;
+    int trials = 20;
+    double tolerance = 0.05;
+    CubicCode code(l, p, 0, false, 1);
+    int errorCount = 0;
+    for (int i = 0; i < trials; ++i)
+    {
+        code.getError().clear();
+        code.generateDataError(false);
+        errorCount += code.getError().size();
+    }
+    double expectedCount = pow(l, 3) * 3 * p * trials;
+    EXPECT_NEAR(expectedCount, errorCount, expectedCount * tolerance);
+}
+
 TEST(generateMeasError, statistics_correct)
 {
     double q = 0.5;
@@ -59,7 +77,94 @@ TEST(generateMeasError, statistics_correct)
             ++errorCount;
         }
     }
-    EXPECT_NEAR(pow(l, 3) * 7 * q, errorCount, pow(l, 3) * 7 * q * tolerance);
-    // Note generate meas error can flip "phantom" syndrome indices, 
-    // but these are always cleared when we call calculateSyndrome()
-}
\ No newline at end of file
+    // Only the x, y and z edges of each vertex are stabilizers
+    EXPECT_NEAR(pow(l, 3) * 3 * q, errorCount, pow(l, 3) * 3 * q * tolerance);
+}
+TEST(clone, shares_lattice_but_not_state)
+{
+    int l = 6;
+    CubicCode code(l, 0.1, 0.1, false, 1);
+    std::unique_ptr<Code> copy = code.clone();
+    EXPECT_EQ(&code.getLattice(), &copy->getLattice());
+    EXPECT_EQ(&code.getSweepIndices(), &copy->getSweepIndices());
+    code.setError({0, 1, 2});
+    code.calculateSyndrome();
+    EXPECT_EQ(copy->getError().size(), 0);
+    auto &syndrome = copy->getSyndrome();
+    EXPECT_TRUE(std::all_of(syndrome.begin(), syndrome.end(), [](int i) { return i == 0; }));
+}
+TEST(geometry, codes_built_from_one_geometry_share_it)
+{
+    int l = 4;
+    auto geometry = CubicCode::buildGeometry(l, false);
+    CubicCode code1(geometry, 0.1, 0.1, 1);
+    CubicCode code2(geometry, 0.2, 0.2, 1);
+    EXPECT_EQ(code1.getGeometry(), code2.getGeometry());
+    EXPECT_EQ(&code1.getLattice(), &code2.getLattice());
+    EXPECT_EQ(code1.getSyndrome().size(), 3 * pow(l, 3));
+    EXPECT_EQ(code2.getFlipBits().size(), 3 * pow(l, 3));
+    // Correlated pairs are added to a copy so other codes are unaffected
+    code1.buildCorrelatedIndices();
+    EXPECT_NE(code1.getGeometry(), code2.getGeometry());
+    EXPECT_EQ(code2.getGeometry()->correlatedIndices.size(), 0);
+    EXPECT_EQ(&code1.getLattice(), &code2.getLattice());
+}
+
+TEST(buildCorrelatedIndices, pairs_faces_sharing_an_edge)
+{
+    int l = 4;
+    auto geometry = CubicCode::buildGeometry(l, false);
+    geometry->buildCorrelatedIndices();
+    auto &faceToEdges = geometry->lattice->getFaceToEdges();
+    vpint expectedPairs;
+    for (int i = 0; i < geometry->numberOfFaces; ++i)
+    {
+        for (int j = i + 1; j < geometry->numberOfFaces; ++j)
+        {
+            for (const int ei : faceToEdges[i])
+            {
+                for (const int ej : faceToEdges[j])
+                {
+                    if (ei == ej)
+                    {
+                        expectedPairs.push_back({i, j});
+                    }
+                }
+            }
+        }
+    }
+    EXPECT_EQ(geometry->correlatedIndices, expectedPairs);
+}
+
+TEST(sweepStencil, sweeps_like_the_sweep_table)
+{
+    int l = 6;
+    auto geometry = CubicCode::buildGeometry(l, false);
+    ASSERT_FALSE(geometry->sweepStencil.empty());
+    EXPECT_TRUE(CubicCode::buildGeometry(l, true)->sweepStencil.empty());
+    auto tableGeometry = std::make_shared<CodeGeometry>(*geometry);
+    tableGeometry->sweepStencil = SweepStencil();
+    tableGeometry->sweepTable = CubicCode(tableGeometry, 0, 0, 1).buildSweepTable();
+    vdir sweepDirections = {Direction::xyz, Direction::xy, Direction::yz, Direction::xz,
+                            -Direction::xyz, -Direction::xy, -Direction::yz, -Direction::xz};
+    for (const bool greedy : {false, true})
+    {
+        CubicCode stencilCode(geometry, 0.2, 0.1, 1);
+        CubicCode tableCode(tableGeometry, 0.2, 0.1, 1);
+        stencilCode.setSeed(1, greedy);
+        tableCode.setSeed(1, greedy);
+        stencilCode.generateDataError(false);
+        tableCode.generateDataError(false);
+        stencilCode.generateMeasError();
+        tableCode.generateMeasError();
+        for (int i = 0; i < 3; ++i)
+        {
+            for (auto &sweepDirection : sweepDirections)
+            {
+                stencilCode.sweep(sweepDirection, greedy);
+                tableCode.sweep(sweepDirection, greedy);
+                EXPECT_EQ(stencilCode.getError().toSet(), tableCode.getError().toSet());
+            }
+        }
+    }
+}
@@ -82,12 +82,12 @@ TEST(edgeIndex, correctly_handles_valid_input)
     int l = 4;
     CubicLattice lattice = CubicLattice(l);
     int vertexIndex = 26;
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "x", 1), 183);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "y", 1), 185);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "z", 1), 187);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "x", -1), 176);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "y", -1), 157);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "z", -1), 75);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "x", 1), 78);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "y", 1), 79);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "z", 1), 80);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "x", -1), 75);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "y", -1), 67);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "z", -1), 32);
 }
 
 TEST(createFaces, correct_number_of_faces_created)
@@ -119,7 +119,7 @@ TEST(createFaces, correct_faces_created)
         EXPECT_EQ(faceToVertices[i], expectedVertices[i]);
     }
 
-    vvint expectedEdges = {{1, 3, 10, 29}, {10, 12, 40, 122}, {8, 10, 17, 36}, {17, 19, 47, 129}, {15, 17, 24, 43}, {29, 33, 40, 141}, {29, 31, 38, 57}, {38, 40, 68, 150}, {36, 40, 47, 148}, {36, 38, 45, 64}}; // Reached faceIndex = 9
+    vvint expectedEdges = {{0, 1, 4, 12}, {4, 5, 17, 52}, {3, 4, 7, 15}, {7, 8, 20, 55}, {6, 7, 10, 18}, {12, 14, 17, 60}, {12, 13, 16, 24}, {16, 17, 29, 64}, {15, 17, 20, 63}, {15, 16, 19, 27}}; // Reached faceIndex = 9
     for (int i = 0; i < expectedEdges.size(); ++i)
     {
         EXPECT_EQ(faceToEdges[i], expectedEdges[i]);
@@ -292,3 +292,31 @@ TEST(createVertexToEdges, correct_number_edges)
         }
     }
 }
+
+TEST(findNeighbour, matches_neighbour_and_edge_index)
+{
+    int l = 6;
+    CubicLattice lattice = CubicLattice(l);
+    std::vector<Direction> directions = {Direction::x, Direction::y, Direction::z};
+    for (int vertexIndex = 0; vertexIndex < l * l * l; ++vertexIndex)
+    {
+        for (const auto direction : directions)
+        {
+            for (const int sign : {1, -1})
+            {
+                int neighbourIndex = lattice.findNeighbour(vertexIndex, {direction, sign});
+                int edge = lattice.findEdge(vertexIndex, {direction, sign});
+                if (neighbourIndex == -1)
+                {
+                    EXPECT_THROW(lattice.neighbour(vertexIndex, direction, sign), std::invalid_argument);
+                    EXPECT_EQ(edge, -1);
+                }
+                else
+                {
+                    EXPECT_EQ(neighbourIndex, lattice.neighbour(vertexIndex, direction, sign));
+                    EXPECT_EQ(edge, lattice.edgeIndex(vertexIndex, direction, sign));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,144 @@
+#include "decoder.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+TEST(runTrials, same_results_for_any_number_of_threads)
+{
+    uint64_t seed = 12345;
+    int trials = 12;
+    auto serial = runTrials(4, 4, 0.05, 0.05, 2, "random", 32, "rhombic_toric", false, false, 1, trials, 1, seed);
+    auto parallel = runTrials(4, 4, 0.05, 0.05, 2, "random", 32, "rhombic_toric", false, false, 1, trials, 3, seed);
+    ASSERT_EQ(serial.results.size(), parallel.results.size());
+    for (int t = 0; t < trials; ++t)
+    {
+        EXPECT_EQ(serial.results[t].success, parallel.results[t].success);
+        EXPECT_EQ(serial.results[t].cleanSyndrome, parallel.results[t].cleanSyndrome);
+    }
+    EXPECT_EQ(serial.successes, parallel.successes);
+}
+
+TEST(oneRun, replays_trial_of_a_run)
+{
+    uint64_t seed = 2;
+    int trials = 8;
+    auto statistics = runTrials(4, 4, 0.1, 0.1, 2, "random", 32, "cubic_boundaries", false, false, 1, trials, 1, seed, 100);
+    for (int t = 0; t < trials; ++t)
+    {
+        std::vector<bool> success = oneRun(4, 4, 0.1, 0.1, 2, "random", 32, "cubic_boundaries", false, false, 1, seed, 100 + t);
+        EXPECT_EQ(success[0], statistics.results[t].success);
+        EXPECT_EQ(success[1], statistics.results[t].cleanSyndrome);
+    }
+}
+
+TEST(code, same_errors_for_same_seed_and_stream)
+{
+    auto geometry = buildGeometry(4, "rhombic_toric", false);
+    auto code1 = buildCode(geometry, 0.2, 0.2, "rhombic_toric", 1);
+    auto code2 = code1->clone();
+    code1->setSeed(7, 3);
+    code2->setSeed(7, 3);
+    code1->generateDataError(false);
+    code2->generateDataError(false);
+    EXPECT_EQ(code1->getError(), code2->getError());
+    code2->getError().clear();
+    code2->setSeed(7, 4);
+    code2->generateDataError(false);
+    EXPECT_NE(code1->getError(), code2->getError());
+}
+
+TEST(oneRun, records_syndrome_weights)
+{
+    int rounds = 6;
+    int timeout = 40;
+    auto code = buildCode(6, 0.05, 0.05, "rhombic_toric", false, 1);
+    runContext context(3, 0);
+    std::vector<bool> success = oneRun(*code, context, 6, rounds, 0.05, 2, "alternating_XZ", timeout, false, false, 1);
+    EXPECT_TRUE(context.syndromeWeights.empty());
+    context.recordSyndromeWeights = true;
+    success = oneRun(*code, context, 6, rounds, 0.05, 2, "alternating_XZ", timeout, false, false, 1);
+    EXPECT_EQ(static_cast<int>(context.syndromeWeights.size()), rounds + context.readoutSweeps);
+    EXPECT_EQ(context.syndromeWeights.back() == 0, success[1]);
+    if (!success[1])
+    {
+        EXPECT_EQ(context.readoutSweeps, timeout);
+    }
+}
+
+TEST(runTrials, reports_syndrome_weights_when_asked)
+{
+    int rounds = 4;
+    auto statistics = runTrials(4, rounds, 0.05, 0.05, 2, "random", 32, "rhombic_toric", false, false, 1, 5, 2, 8, 0, "", true);
+    for (const auto &result : statistics.results)
+    {
+        EXPECT_EQ(static_cast<int>(result.syndromeWeights.size()), rounds + result.readoutSweeps);
+    }
+    statistics = runTrials(4, rounds, 0.05, 0.05, 2, "random", 32, "rhombic_toric", false, false, 1, 5, 2, 8);
+    for (const auto &result : statistics.results)
+    {
+        EXPECT_TRUE(result.syndromeWeights.empty());
+    }
+}
+
+TEST(runBitSlicedTrials, same_results_for_any_number_of_threads)
+{
+    uint64_t seed = 5;
+    int trials = 150;
+    auto serial = runBitSlicedTrials(4, 4, 0.05, 0.05, 2, "random", 32, "cubic_boundaries", false, true, 1, trials, 1, seed);
+    auto parallel = runBitSlicedTrials(4, 4, 0.05, 0.05, 2, "random", 32, "cubic_boundaries", false, true, 1, trials, 2, seed);
+    ASSERT_EQ(static_cast<int>(serial.results.size()), trials);
+    for (int t = 0; t < trials; ++t)
+    {
+        EXPECT_EQ(serial.results[t].success, parallel.results[t].success);
+        EXPECT_EQ(serial.results[t].readoutSweeps, parallel.results[t].readoutSweeps);
+    }
+    EXPECT_EQ(serial.successes, parallel.successes);
+    EXPECT_THROW(runBitSlicedTrials(4, 4, 0.05, 0.05, 2, "random", 32, "cubic_boundaries", false, false, 1, trials, 1, seed, 10), std::invalid_argument);
+}
+
+TEST(runBitSlicedTrials, succeeds_without_errors)
+{
+    auto statistics = runBitSlicedTrials(4, 4, 0, 0, 2, "alternating_XZ", 32, "rhombic_toric", true, false, 1, 70, 1, 1);
+    EXPECT_EQ(statistics.successes, 70);
+    EXPECT_EQ(statistics.cleanSyndromes, 70);
+}
+
+TEST(runGrid, points_draw_from_disjoint_trials_in_grid_order)
+{
+    uint64_t seed = 9;
+    std::vector<gridPoint> points = {
+        {4, 0.1, 0.1, 4, "rhombic_toric", 2, "random", 32, false, false, 1, 12, 0},
+        {4, 0.1, 0.1, 4, "rhombic_toric", 2, "random", 32, false, false, 1, 12, 0},
+        {6, 0.05, 0.05, 4, "cubic_boundaries", 2, "random", 48, false, true, 1, 10, 2},
+        {4, 0.08, 0.08, 4, "rhombic_toric", 3, "rotating_XY", 32, true, false, 2, 5, 3}};
+    std::vector<int> reported;
+    std::vector<std::vector<trialResult>> pointResults(points.size());
+    runGrid(points, 3, seed, [&](const int i, const trialStatistics &statistics) {
+        reported.push_back(i);
+        pointResults[i] = statistics.results;
+        // Point i runs the trials which follow those of the points before it
+        int firstTrial = 0;
+        for (int j = 0; j < i; ++j)
+        {
+            firstTrial += points[j].trials;
+        }
+        const gridPoint &point = points[i];
+        auto expected = runTrials(point.l, point.rounds, point.p, point.q, point.sweepLimit, point.sweepSchedule, point.timeout,
+                                  point.latticeType, point.greedy, point.correlatedErrors, point.sweepRate, point.trials, 1, seed, firstTrial);
+        ASSERT_EQ(statistics.results.size(), expected.results.size());
+        for (int t = 0; t < point.trials; ++t)
+        {
+            EXPECT_EQ(statistics.results[t].success, expected.results[t].success);
+            EXPECT_EQ(statistics.results[t].cleanSyndrome, expected.results[t].cleanSyndrome);
+            EXPECT_EQ(statistics.results[t].readoutSweeps, expected.results[t].readoutSweeps);
+        }
+        EXPECT_EQ(statistics.successes, expected.successes);
+    });
+    EXPECT_EQ(reported, std::vector<int>({0, 1, 2, 3}));
+    // Two points with the same parameters still draw different errors
+    bool differ = false;
+    for (int t = 0; t < points[0].trials; ++t)
+    {
+        differ |= pointResults[0][t].readoutSweeps != pointResults[1][t].readoutSweeps;
+    }
+    EXPECT_TRUE(differ);
+}
@@ -0,0 +1,40 @@
+#include "flatLists.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+TEST(FlatLists, matches_nested_vectors)
+{
+    std::vector<std::vector<int>> lists = {{1, 2, 3}, {}, {4}, {5, 6}};
+    FlatLists<int> flatLists(lists);
+    EXPECT_EQ(flatLists.size(), 4);
+    for (int i = 0; i < lists.size(); ++i)
+    {
+        EXPECT_EQ(flatLists[i].size(), lists[i].size());
+        EXPECT_EQ(flatLists[i], lists[i]);
+    }
+    std::vector<std::vector<int>> copy = flatLists;
+    EXPECT_EQ(copy, lists);
+    int i = 0;
+    for (const auto &list : flatLists)
+    {
+        EXPECT_EQ(list, lists[i++]);
+    }
+    EXPECT_EQ(i, 4);
+}
+
+TEST(FlatLists, fixed_width_lists)
+{
+    FlatLists<int> flatLists(4);
+    flatLists.push_back({0, 1, 2, 3});
+    flatLists.push_back({4, 5, 6, 7});
+    EXPECT_EQ(flatLists.size(), 2);
+    std::vector<int> expected = {4, 5, 6, 7};
+    EXPECT_EQ(flatLists[1], expected);
+    EXPECT_EQ(flatLists[1][2], 6);
+}
+
+TEST(push_back, excepts_wrong_width)
+{
+    FlatLists<int> flatLists(4);
+    EXPECT_THROW(flatLists.push_back({0, 1, 2}), std::invalid_argument);
+}
@@ -0,0 +1,197 @@
+#include "geometryCache.h"
+#include "decoder.h"
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class GeometryCacheTest : public ::testing::Test
+{
+  protected:
+    std::string directory;
+
+    void SetUp() override
+    {
+        char name[] = "/tmp/geometryCacheXXXXXX";
+        ASSERT_NE(mkdtemp(name), nullptr);
+        directory = name;
+    }
+    void TearDown() override
+    {
+        std::system(("rm -rf " + directory).c_str());
+    }
+};
+
+// Every table of a geometry as the bytes a TableWriter writes
+std::string tableBytes(CodeGeometry &geometry)
+{
+    std::ostringstream stream;
+    TableWriter writer(stream);
+    geometry.transferTables(writer);
+    return stream.str();
+}
+
+// Stands for the fingerprint of the rules in tests which don't change them
+const uint64_t rules = 1;
+
+// A newly constructed lattice for GeometryCache::load
+std::shared_ptr<Lattice> newLattice(const int l, const std::string &latticeType)
+{
+    const bool boundaries = latticeType.find("boundaries") != std::string::npos;
+    if (latticeType.compare(0, 7, "rhombic") == 0)
+    {
+        return RhombicCode::buildLattice(l, boundaries);
+    }
+    return CubicCode::buildLattice(l, boundaries);
+}
+
+TEST_F(GeometryCacheTest, loads_the_tables_which_were_saved)
+{
+    const int l = 6;
+    for (const std::string latticeType : {"rhombic_boundaries", "rhombic_toric", "cubic_boundaries", "cubic_toric"})
+    {
+        auto built = std::const_pointer_cast<CodeGeometry>(buildGeometry(l, latticeType, false));
+        GeometryCache cache(directory);
+        EXPECT_EQ(cache.load(latticeType, l, newLattice(l, latticeType), rules), nullptr);
+        ASSERT_TRUE(cache.save(latticeType, *built, rules));
+        auto loaded = cache.load(latticeType, l, newLattice(l, latticeType), rules);
+        ASSERT_NE(loaded, nullptr) << latticeType;
+        EXPECT_EQ(tableBytes(*loaded), tableBytes(*built)) << latticeType;
+        EXPECT_EQ(loaded->lattice->getNumberOfVertices(), built->lattice->getNumberOfVertices());
+    }
+}
+
+TEST_F(GeometryCacheTest, ignores_files_of_another_lattice)
+{
+    GeometryCache cache(directory);
+    ASSERT_TRUE(cache.save("rhombic_toric", *RhombicCode::buildGeometry(4, false), rules));
+    EXPECT_EQ(cache.load("rhombic_toric", 6, newLattice(6, "rhombic_toric"), rules), nullptr);
+    // The file of one size moved to the name of another is rejected
+    std::rename(cache.path("rhombic_toric", 4).c_str(), cache.path("rhombic_toric", 6).c_str());
+    EXPECT_EQ(cache.load("rhombic_toric", 6, newLattice(6, "rhombic_toric"), rules), nullptr);
+}
+
+TEST_F(GeometryCacheTest, ignores_damaged_files)
+{
+    GeometryCache cache(directory);
+    ASSERT_TRUE(cache.save("rhombic_boundaries", *RhombicCode::buildGeometry(4, true), rules));
+    const std::string path = cache.path("rhombic_boundaries", 4);
+    std::string bytes;
+    {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    // Truncated
+    std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size() - 1);
+    EXPECT_EQ(cache.load("rhombic_boundaries", 4, newLattice(4, "rhombic_boundaries"), rules), nullptr);
+    // Another format version, which follows the eight bytes of the magic
+    std::string otherVersion = bytes;
+    otherVersion[8] += 1;
+    std::ofstream(path, std::ios::binary).write(otherVersion.data(), otherVersion.size());
+    EXPECT_EQ(cache.load("rhombic_boundaries", 4, newLattice(4, "rhombic_boundaries"), rules), nullptr);
+    // Trailing bytes
+    std::ofstream(path, std::ios::binary).write((bytes + "x").data(), bytes.size() + 1);
+    EXPECT_EQ(cache.load("rhombic_boundaries", 4, newLattice(4, "rhombic_boundaries"), rules), nullptr);
+    std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size());
+    EXPECT_NE(cache.load("rhombic_boundaries", 4, newLattice(4, "rhombic_boundaries"), rules), nullptr);
+}
+
+TEST_F(GeometryCacheTest, ignores_files_saved_by_other_rules)
+{
+    GeometryCache cache(directory);
+    ASSERT_TRUE(cache.save("cubic_toric", *CubicCode::buildGeometry(4, false), rules));
+    EXPECT_EQ(cache.load("cubic_toric", 4, newLattice(4, "cubic_toric"), rules + 1), nullptr);
+    EXPECT_NE(cache.load("cubic_toric", 4, newLattice(4, "cubic_toric"), rules), nullptr);
+}
+
+TEST(GeometryCache, fingerprint_depends_on_the_tables)
+{
+    const int l = GeometryCache::fingerprintL;
+    const uint64_t rhombic = GeometryCache::fingerprint(*RhombicCode::buildGeometry(l, true));
+    EXPECT_EQ(GeometryCache::fingerprint(*RhombicCode::buildGeometry(l, true)), rhombic);
+    EXPECT_NE(GeometryCache::fingerprint(*RhombicCode::buildGeometry(l, false)), rhombic);
+    auto changed = RhombicCode::buildGeometry(l, true);
+    changed->sweepTable.decisions[0].options ^= 1;
+    EXPECT_NE(GeometryCache::fingerprint(*changed), rhombic);
+}
+
+TEST_F(GeometryCacheTest, loaded_tables_outlive_the_file)
+{
+    const int l = 6;
+    auto built = RhombicCode::buildGeometry(l, false);
+    GeometryCache cache(directory);
+    ASSERT_TRUE(cache.save("rhombic_toric", *built, rules));
+    auto loaded = cache.load("rhombic_toric", l, newLattice(l, "rhombic_toric"), rules);
+    ASSERT_NE(loaded, nullptr);
+    // The mapping is kept by the geometry, not by the file
+    std::remove(cache.path("rhombic_toric", l).c_str());
+    EXPECT_EQ(tableBytes(*loaded), tableBytes(*built));
+    auto copy = std::make_shared<CodeGeometry>(*loaded);
+    loaded.reset();
+    EXPECT_EQ(tableBytes(*copy), tableBytes(*built));
+}
+
+TEST(TableReader, views_arrays_in_a_source_and_copies_them_otherwise)
+{
+    std::ostringstream stream;
+    TableWriter writer(stream);
+    writer(static_cast<int8_t>(3));
+    writer(TableArray<int>(std::vector<int>{4, 5, 6}));
+    const std::string bytes = stream.str();
+    auto source = std::make_shared<std::vector<uint64_t>>((bytes.size() + 7) / 8);
+    char *data = reinterpret_cast<char *>(source->data());
+    std::memcpy(data, bytes.data(), bytes.size());
+
+    int8_t first = 0;
+    TableArray<int> viewed;
+    TableReader reader(data, bytes.size(), source);
+    reader(first);
+    reader(viewed);
+    EXPECT_TRUE(reader.good() && reader.atEnd());
+    EXPECT_TRUE(viewed.isView());
+    EXPECT_EQ(std::vector<int>(viewed.begin(), viewed.end()), std::vector<int>({4, 5, 6}));
+    EXPECT_GE(reinterpret_cast<const char *>(viewed.data()), data);
+    EXPECT_LT(reinterpret_cast<const char *>(viewed.data()), data + bytes.size());
+    // Changing a view copies it first
+    viewed[0] = 7;
+    EXPECT_FALSE(viewed.isView());
+    EXPECT_EQ(reinterpret_cast<const int *>(data + 16)[0], 4);
+
+    TableArray<int> copied;
+    TableReader copier(data, bytes.size());
+    copier(first);
+    copier(copied);
+    EXPECT_TRUE(copier.good() && copier.atEnd());
+    EXPECT_FALSE(copied.isView());
+    EXPECT_EQ(std::vector<int>(copied.begin(), copied.end()), std::vector<int>({4, 5, 6}));
+}
+
+TEST_F(GeometryCacheTest, same_results_with_a_saved_geometry)
+{
+    const uint64_t seed = 11;
+    const int trials = 8;
+    for (const std::string latticeType : {"rhombic_boundaries", "cubic_toric"})
+    {
+        auto uncached = runTrials(6, 6, 0.03, 0.03, 4, "random", 32, latticeType, false, true, 1, trials, 1, seed);
+        // The first run saves the geometry and the second loads it
+        for (int run = 0; run < 2; ++run)
+        {
+            auto cached = runTrials(6, 6, 0.03, 0.03, 4, "random", 32, latticeType, false, true, 1, trials, 1, seed, 0, directory);
+            for (int t = 0; t < trials; ++t)
+            {
+                EXPECT_EQ(cached.results[t].success, uncached.results[t].success);
+                EXPECT_EQ(cached.results[t].cleanSyndrome, uncached.results[t].cleanSyndrome);
+                EXPECT_EQ(cached.results[t].readoutSweeps, uncached.results[t].readoutSweeps);
+            }
+        }
+    }
+}
+
+TEST(GeometryCache, empty_directory_throws)
+{
+    EXPECT_THROW(GeometryCache(""), std::invalid_argument);
+}
@@ -20,10 +20,10 @@ TEST(indexToCoordinate, handles_positive_indices)
     int vertexIndex = 0;
     EXPECT_EQ(lattice.indexToCoordinate(vertexIndex), coordinate);
     coordinate = {1, 2, 3, 0};
-    vertexIndex = 57;
+    vertexIndex = 28;
     EXPECT_EQ(lattice.indexToCoordinate(vertexIndex), coordinate);
     coordinate = {0, 1, 0, 1};
-    vertexIndex = 68;
+    vertexIndex = 36;
     EXPECT_EQ(lattice.indexToCoordinate(vertexIndex), coordinate);
 }
 
@@ -51,15 +51,18 @@ TEST(coordinateToIndex, handles_positive_coordinates)
 {
     int l = 4;
     RhombicToricLattice lattice = RhombicToricLattice(l);
-    int vertexIndex = 64;
+    int vertexIndex = 32;
     cartesian4 coordinate = {0, 0, 0, 1};
     EXPECT_EQ(lattice.indexToCoordinate(vertexIndex), coordinate);
-    vertexIndex = 42;
+    vertexIndex = 21;
     coordinate = {2, 2, 2, 0};
     EXPECT_EQ(lattice.indexToCoordinate(vertexIndex), coordinate);
-    vertexIndex = 105;
+    vertexIndex = 73;
     coordinate = {1, 2, 2, 1};
     EXPECT_EQ(lattice.indexToCoordinate(vertexIndex), coordinate);
+    EXPECT_EQ(lattice.coordinateToIndex(coordinate), vertexIndex);
+    // Odd sites of the w = 0 sub-lattice hold no vertex
+    EXPECT_EQ(lattice.coordinateToIndex({1, 0, 0, 0}), -1);
 }
 
 TEST(neighbourRhombicToric, excepts_invalid_signs)
@@ -74,6 +77,45 @@ TEST(neighbourRhombicToric, excepts_invalid_signs)
     EXPECT_THROW(lattice.neighbour(vertexIndex, direction, -6), std::invalid_argument);
 }
 
+TEST(toSignedDirection, round_trips_names)
+{
+    vstr names = {"xyz", "x", "xy", "y", "yz", "z", "xz",
+                  "-xyz", "-x", "-xy", "-y", "-yz", "-z", "-xz"};
+    for (int i = 0; i < names.size(); ++i)
+    {
+        SignedDirection direction = toSignedDirection(names[i]);
+        EXPECT_EQ(direction.index(), i);
+        EXPECT_EQ(toString(direction), names[i]);
+    }
+    EXPECT_EQ(toSignedDirection("-xy"), -Direction::xy);
+    EXPECT_THROW(toSignedDirection("xx"), std::invalid_argument);
+    EXPECT_THROW(toSignedDirection("-"), std::invalid_argument);
+    EXPECT_THROW(toDirection(""), std::invalid_argument);
+}
+
+TEST(neighbourRhombicToric, enum_matches_string_directions)
+{
+    int l = 4;
+    RhombicToricLattice lattice = RhombicToricLattice(l);
+    for (const std::string &name : {"xyz", "xy", "xz", "yz"})
+    {
+        for (int vertexIndex = 0; vertexIndex < lattice.getNumberOfVertices(); ++vertexIndex)
+        {
+            for (int sign : {1, -1})
+            {
+                if (lattice.findNeighbour(vertexIndex, {toDirection(name), sign}) == -1)
+                {
+                    EXPECT_THROW(lattice.neighbour(vertexIndex, toDirection(name), sign), std::invalid_argument);
+                    EXPECT_THROW(lattice.neighbour(vertexIndex, name, sign), std::invalid_argument);
+                    continue;
+                }
+                EXPECT_EQ(lattice.neighbour(vertexIndex, toDirection(name), sign), lattice.neighbour(vertexIndex, name, sign));
+                EXPECT_EQ(lattice.edgeIndex(vertexIndex, toDirection(name), sign), lattice.edgeIndex(vertexIndex, name, sign));
+            }
+        }
+    }
+}
+
 // TEST(createFacesBCC, handles_valid_input)
 // {
 //     int l = 4;
@@ -0,0 +1,73 @@
+#include "parameterGrid.h"
+#include "gtest/gtest.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+std::vector<gridPoint> readGrid(const std::string &csv)
+{
+    std::istringstream input(csv);
+    return ParameterGrid(input).getPoints();
+}
+
+TEST(ParameterGrid, reads_input_file_format)
+{
+    auto points = readGrid("L,p,cycles,trials,job_number\r\n4,0.19,0,100,0\r\n6,0.19,0,100,1\r\n\r\n");
+    ASSERT_EQ(points.size(), 2);
+    EXPECT_EQ(points[1].l, 6);
+    EXPECT_EQ(points[1].p, 0.19);
+    EXPECT_EQ(points[1].rounds, 0);
+    EXPECT_EQ(points[1].trials, 100);
+    EXPECT_EQ(points[1].jobNumber, 1);
+    // Defaults of data_generator.py
+    EXPECT_EQ(points[1].q, 0.19);
+    EXPECT_EQ(points[1].latticeType, "rhombic_toric");
+    EXPECT_EQ(points[1].sweepLimit, 2);
+    EXPECT_EQ(points[1].sweepSchedule, "random");
+    EXPECT_EQ(points[1].timeout, 192);
+    EXPECT_FALSE(points[1].greedy);
+    EXPECT_FALSE(points[1].correlatedErrors);
+    EXPECT_EQ(points[1].sweepRate, 1);
+}
+
+TEST(ParameterGrid, expands_cells_with_several_values)
+{
+    auto points = readGrid("sweep_schedule, L, p, q, cycles, trials, greedy\n"
+                           "alternating_XZ, 8 10, 0.01 0.02 0.03, , 16, 5, true\n"
+                           "random, 12, 0.04, 0.001, 16, 5, false\n");
+    ASSERT_EQ(points.size(), 7);
+    std::vector<int> ls;
+    std::vector<double> ps;
+    for (const auto &point : points)
+    {
+        ls.push_back(point.l);
+        ps.push_back(point.p);
+    }
+    EXPECT_EQ(ls, std::vector<int>({8, 8, 8, 10, 10, 10, 12}));
+    EXPECT_EQ(ps, std::vector<double>({0.01, 0.02, 0.03, 0.01, 0.02, 0.03, 0.04}));
+    EXPECT_EQ(points[4].q, 0.02);
+    EXPECT_TRUE(points[4].greedy);
+    EXPECT_EQ(points[6].q, 0.001);
+    EXPECT_EQ(points[6].sweepSchedule, "random");
+    EXPECT_FALSE(points[6].greedy);
+}
+
+TEST(ParameterGrid, writes_points_under_header)
+{
+    auto points = readGrid("L,p,cycles,trials,lattice_type,correlated_errors\n4,0.5,2,3,cubic_boundaries,true\n");
+    std::ostringstream output;
+    ParameterGrid::writePoint(output, points[0]);
+    EXPECT_EQ(ParameterGrid::header(), "L,p,q,cycles,trials,lattice_type,sweep_limit,sweep_schedule,timeout,greedy,correlated_errors,sweep_rate,job_number");
+    EXPECT_EQ(output.str(), "4,0.5,0.5,2,3,cubic_boundaries,2,random,128,false,true,1,-1");
+}
+
+TEST(ParameterGrid, invalid_grids_throw)
+{
+    EXPECT_THROW(readGrid("L,p,cycles,trials,colour\n4,0.1,0,1,red\n"), std::invalid_argument);
+    EXPECT_THROW(readGrid("L,p,L,cycles,trials\n4,0.1,4,0,1\n"), std::invalid_argument);
+    EXPECT_THROW(readGrid("L,p,trials\n4,0.1,1\n"), std::invalid_argument);
+    EXPECT_THROW(readGrid("L,p,cycles,trials\n4,0.1,0\n"), std::invalid_argument);
+    EXPECT_THROW(readGrid("L,p,cycles,trials\n4,0.1x,0,1\n"), std::invalid_argument);
+    EXPECT_THROW(readGrid("L,p,cycles,trials\n4,0.1,0,0\n"), std::invalid_argument);
+    EXPECT_THROW(readGrid("L,p,cycles,trials,greedy\n4,0.1,0,1,yes\n"), std::invalid_argument);
+}
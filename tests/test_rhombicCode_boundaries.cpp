@@ -2,6 +2,7 @@
 #include "rhombicLattice.h"
 #include "gtest/gtest.h"
 #include <string>
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <cmath>
@@ -37,7 +38,7 @@ TEST(buildSyndromeIndices, syndrome_correct_edges)
             int vertexIndex = lattice.coordinateToIndex(coordinateList[i]);
             for (int j = 0; j < expectedEdgeDirections[i].size(); ++j)
             {
-                auto it = syndromeIndices.find(lattice.edgeIndex(vertexIndex, expectedEdgeDirections[i][j], expectedEdgeSigns[i][j]));
+                auto it = std::find(syndromeIndices.begin(), syndromeIndices.end(), lattice.edgeIndex(vertexIndex, expectedEdgeDirections[i][j], expectedEdgeSigns[i][j]));
                 EXPECT_FALSE(it == syndromeIndices.end());
             }
         }
@@ -108,7 +109,7 @@ TEST(calculateSyndrome, no_invalid_syndromes_data_errors)
             {
                 if (syndrome[i] == 1)
                 {
-                    auto it = syndromeIndices.find(i);
+                    auto it = std::find(syndromeIndices.begin(), syndromeIndices.end(), i);
                     EXPECT_FALSE(it == syndromeIndices.end());
                 }
             }
@@ -132,7 +133,7 @@ TEST(calculateSyndrome, no_invalid_syndromes_meas_errors)
             {
                 if (syndrome[i] == 1)
                 {
-                    auto it = syndromeIncdices.find(i);
+                    auto it = std::find(syndromeIncdices.begin(), syndromeIncdices.end(), i);
                     EXPECT_FALSE(it == syndromeIncdices.end());
                 }
             }
@@ -158,7 +159,7 @@ TEST(calculateSyndrome, no_invalid_syndromes_both_errors)
             {
                 if (syndrome[i] == 1)
                 {
-                    auto it = syndromeIndices.find(i);
+                    auto it = std::find(syndromeIndices.begin(), syndromeIndices.end(), i);
                     EXPECT_FALSE(it == syndromeIndices.end());
                 }
             }
@@ -450,9 +451,9 @@ TEST(buildSweepIndices, correct_indices_L4)
     int l = 4;
     double p = 0.1;
     RhombicCode code(l, p, p, true, 1);
-    vint &sweepIndices = code.getSweepIndices();
+    const vint &sweepIndices = code.getSweepIndices();
     auto &lattice = code.getLattice();
-    vint expectedIndices = {21, 23, 24, 26, 36, 38, 41, 43, 53, 55, 56, 58, 80, 81, 82, 84, 85, 86, 88, 89, 90, 96, 97, 98, 100, 101, 102, 104, 105, 106};
+    vint expectedIndices = {10, 11, 12, 13, 18, 19, 20, 21, 26, 27, 28, 29, 48, 49, 50, 52, 53, 54, 56, 57, 58, 64, 65, 66, 68, 69, 70, 72, 73, 74};
     for (int i = 0; i < sweepIndices.size(); ++i)
     {
         EXPECT_EQ(sweepIndices[i], expectedIndices[i]);
@@ -466,7 +467,7 @@ TEST(buildSweepIndices, correct_number_of_indices)
     for (auto const l : ls)
     {
         RhombicCode code(l, p, p, true, 1);
-        vint &sweepIndices = code.getSweepIndices();
+        const vint &sweepIndices = code.getSweepIndices();
         int expectedSize = ((l - 1) * (l - 1) * (l - 2) + ((l * (l - 2) * (l - 1)) / 2));
         EXPECT_EQ(sweepIndices.size(), expectedSize);
     }
@@ -527,4 +528,101 @@ TEST(generateErrors, correlated_error_model_runs)
 //         EXPECT_EQ(finalErrorLowRate, finalErrorSanity);
 //         EXPECT_EQ(lowRateSyndrome, sanitySyndrome);
 //     }
-// }
\ No newline at end of file
+// }
+
+TEST(buildSweepTable, table_matches_rule_at_every_vertex)
+{
+    const int l = 6;
+    RhombicCode code(l, 0, 0, true, 1);
+    auto &table = code.getGeometry()->sweepTable;
+    auto &lattice = code.getLattice();
+    auto &syndromeIndices = code.getSyndromeIndices();
+    vdir sweepDirections = {Direction::xyz, Direction::xy, Direction::xz, Direction::yz,
+                            -Direction::xyz, -Direction::xy, -Direction::xz, -Direction::yz};
+    for (const int vertexIndex : code.getSweepIndices())
+    {
+        for (auto &direction : sweepDirections)
+        {
+            vdir edgeDirections = code.sweepEdgeDirections(direction);
+            auto &upEdges = lattice.getUpEdges(vertexIndex, direction);
+            for (int mask = 1; mask < (1 << upEdges.size()); ++mask)
+            {
+                // Only stabilisers of the code can be in the syndrome
+                std::vector<int8_t> syndrome(lattice.getNumberOfEdges(), 0);
+                bool validSyndrome = true;
+                for (int i = 0; i < upEdges.size(); ++i)
+                {
+                    syndrome[upEdges[i]] = (mask >> i) & 1;
+                    if (syndrome[upEdges[i]] == 1 && !std::binary_search(syndromeIndices.begin(), syndromeIndices.end(), upEdges[i]))
+                    {
+                        validSyndrome = false;
+                    }
+                }
+                if (!validSyndrome)
+                {
+                    continue;
+                }
+                code.setSyndrome(syndrome);
+                auto &decision = table.decision(vertexIndex, direction, mask);
+                ASSERT_GT(decision.options, 0);
+                std::vector<std::set<int>> options;
+                for (int option = 0, begin = decision.begin; option < decision.options; ++option)
+                {
+                    std::set<int> faces;
+                    for (int i = begin + 1; i <= begin + table.slots[begin]; ++i)
+                    {
+                        const int face = table.vertexFaces[table.vertexFacesBegin[vertexIndex] + table.slots[i]];
+                        if (face != -1 && !faces.erase(face))
+                        {
+                            faces.insert(face);
+                        }
+                    }
+                    options.push_back(faces);
+                    begin += 1 + table.slots[begin];
+                }
+                // The rule flips the faces of one of the options
+                for (int run = 0; run < 10; ++run)
+                {
+                    code.clearFlipBits();
+                    code.sweepVertex(vertexIndex, direction, edgeDirections);
+                    auto &flipBits = code.getFlipBits();
+                    std::set<int> flipped;
+                    for (int i = 0; i < flipBits.size(); ++i)
+                    {
+                        if (flipBits[i] == 1)
+                        {
+                            flipped.insert(i);
+                        }
+                    }
+                    EXPECT_NE(std::find(options.begin(), options.end(), flipped), options.end());
+                }
+            }
+        }
+    }
+}
+
+TEST(updateSyndrome, matches_calculated_syndrome)
+{
+    int l = 6;
+    RhombicCode code(l, 0.05, 0.05, true, 2);
+    code.buildCorrelatedIndices();
+    auto expected = code;
+    vstr directions = {"xyz", "-xz", "-yz", "xy"};
+    for (int r = 0; r < 8; ++r)
+    {
+        code.generateDataError(r % 2 == 1);
+        code.updateSyndrome();
+        expected.getError() = code.getError();
+        expected.calculateSyndrome();
+        EXPECT_EQ(code.getSyndrome(), expected.getSyndrome());
+        EXPECT_EQ(code.getUnsatisfiedCount(), expected.getSyndrome().count());
+        code.generateMeasError();
+        code.sweep(directions[r % 4], true);
+        code.sweep(directions[r % 4], true);
+    }
+    code.updateSyndrome();
+    expected.getError() = code.getError();
+    expected.calculateSyndrome();
+    EXPECT_EQ(code.getSyndrome(), expected.getSyndrome());
+    EXPECT_EQ(code.getUnsatisfiedCount(), expected.getSyndrome().count());
+}
@@ -21,7 +21,7 @@ TEST(RhombicCode, syndrome_correct_size)
     {
         RhombicCode code(l, 0.1, 0.1, false, 1);
         auto syndrome = code.getSyndrome();
-        EXPECT_EQ(syndrome.size(), 2 * 7 * l * l * l);
+        EXPECT_EQ(syndrome.size(), 4 * l * l * l);
     }
 }
 
@@ -35,7 +35,7 @@ TEST(calculateSyndrome, correctly_calculates_error)
     code.setError(error);
     code.calculateSyndrome();
     auto syndrome = code.getSyndrome();
-    vint expectedUnsatisfied = {4, 6, 1516, 1518, 1547, 1722};
+    vint expectedUnsatisfied = {3, 2, 175, 150, 172, 148};
     for (int i = 0; i < syndrome.size(); ++i)
     {
         if (std::find(expectedUnsatisfied.begin(), expectedUnsatisfied.end(), i) != expectedUnsatisfied.end())
@@ -89,11 +89,9 @@ TEST(generateMeasError, handles_error_probability_one)
     double p = 1;
     RhombicCode code(l, p, p, false, 1);
     code.generateMeasError();
-    auto syndrome = code.getSyndrome();
-    for (const int value : syndrome)
-    {
-        EXPECT_EQ(value, 1);
-    }
+    // Every stabilizer is flipped, edge indices which are not edges are not
+    EXPECT_EQ(code.getSyndrome(), code.getGeometry()->syndromeMask);
+    EXPECT_EQ(code.getUnsatisfiedCount(), 4 * pow(l, 3));
 }
 
 TEST(generateMeasError, handles_error_probability_zero)
@@ -117,52 +115,44 @@ TEST(checkExtremalVertex, correct_extremal_vertices_one_error)
     code.setError({0});
     code.calculateSyndrome();
     EXPECT_TRUE(code.checkExtremalVertex(0, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(20, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(64, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(67, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(10, "xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(32, "xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(35, "xyz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(20, "xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(64, "xy"));
-    EXPECT_TRUE(code.checkExtremalVertex(67, "xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(10, "xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(32, "xy"));
+    EXPECT_TRUE(code.checkExtremalVertex(35, "xy"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "-yz"));
-    EXPECT_TRUE(code.checkExtremalVertex(20, "-yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(64, "-yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(67, "-yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "-yz"));
+    EXPECT_TRUE(code.checkExtremalVertex(10, "-yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(32, "-yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(35, "-yz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "-xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(20, "-xz"));
-    EXPECT_TRUE(code.checkExtremalVertex(64, "-xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(67, "-xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "-xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(10, "-xz"));
+    EXPECT_TRUE(code.checkExtremalVertex(32, "-xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(35, "-xz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "-xyz"));
-    EXPECT_TRUE(code.checkExtremalVertex(20, "-xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(64, "-xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(67, "-xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "-xyz"));
+    EXPECT_TRUE(code.checkExtremalVertex(10, "-xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(32, "-xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(35, "-xyz"));
 
     EXPECT_TRUE(code.checkExtremalVertex(0, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(20, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(64, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(67, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(10, "yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(32, "yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(35, "yz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(20, "xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(64, "xz"));
-    EXPECT_TRUE(code.checkExtremalVertex(67, "xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(10, "xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(32, "xz"));
+    EXPECT_TRUE(code.checkExtremalVertex(35, "xz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "-xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(20, "-xy"));
-    EXPECT_TRUE(code.checkExtremalVertex(64, "-xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(67, "-xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "-xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(10, "-xy"));
+    EXPECT_TRUE(code.checkExtremalVertex(32, "-xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(35, "-xy"));
 }
 
 TEST(checkExtremalVertex, correct_extremal_vertices_two_errors)
@@ -173,68 +163,60 @@ TEST(checkExtremalVertex, correct_extremal_vertices_two_errors)
     code.setError({0, 1});
     code.calculateSyndrome();
     EXPECT_TRUE(code.checkExtremalVertex(0, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(37, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(42, "xyz"));
-    EXPECT_TRUE(code.checkExtremalVertex(216, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(221, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(246, "xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(18, "xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(21, "xyz"));
+    EXPECT_TRUE(code.checkExtremalVertex(108, "xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(113, "xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(138, "xyz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(37, "xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(42, "xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(216, "xy"));
-    EXPECT_TRUE(code.checkExtremalVertex(221, "xy"));
-    EXPECT_TRUE(code.checkExtremalVertex(246, "xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(18, "xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(21, "xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(108, "xy"));
+    EXPECT_TRUE(code.checkExtremalVertex(113, "xy"));
+    EXPECT_TRUE(code.checkExtremalVertex(138, "xy"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(37, "xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(42, "xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(216, "xz"));
-    EXPECT_TRUE(code.checkExtremalVertex(221, "xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(246, "xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(18, "xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(21, "xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(108, "xz"));
+    EXPECT_TRUE(code.checkExtremalVertex(113, "xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(138, "xz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(37, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(42, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(216, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(221, "yz"));
-    EXPECT_TRUE(code.checkExtremalVertex(246, "yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(18, "yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(21, "yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(108, "yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(113, "yz"));
+    EXPECT_TRUE(code.checkExtremalVertex(138, "yz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "-xyz"));
-    EXPECT_TRUE(code.checkExtremalVertex(37, "-xyz"));
-    EXPECT_TRUE(code.checkExtremalVertex(42, "-xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(216, "-xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(221, "-xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(246, "-xyz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "-xyz"));
+    EXPECT_TRUE(code.checkExtremalVertex(18, "-xyz"));
+    EXPECT_TRUE(code.checkExtremalVertex(21, "-xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(108, "-xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(113, "-xyz"));
+    EXPECT_FALSE(code.checkExtremalVertex(138, "-xyz"));
 
     EXPECT_TRUE(code.checkExtremalVertex(0, "-xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(37, "-xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(42, "-xy"));
-    EXPECT_TRUE(code.checkExtremalVertex(216, "-xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(221, "-xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(246, "-xy"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "-xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(18, "-xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(21, "-xy"));
+    EXPECT_TRUE(code.checkExtremalVertex(108, "-xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(113, "-xy"));
+    EXPECT_FALSE(code.checkExtremalVertex(138, "-xy"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "-yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(37, "-yz"));
-    EXPECT_TRUE(code.checkExtremalVertex(42, "-yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(216, "-yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(221, "-yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(246, "-yz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "-yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(18, "-yz"));
+    EXPECT_TRUE(code.checkExtremalVertex(21, "-yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(108, "-yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(113, "-yz"));
+    EXPECT_FALSE(code.checkExtremalVertex(138, "-yz"));
 
     EXPECT_FALSE(code.checkExtremalVertex(0, "-xz"));
-    EXPECT_TRUE(code.checkExtremalVertex(37, "-xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(42, "-xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(216, "-xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(221, "-xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(246, "-xz"));
-    EXPECT_FALSE(code.checkExtremalVertex(1, "yz"));
+    EXPECT_TRUE(code.checkExtremalVertex(18, "-xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(21, "-xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(108, "-xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(113, "-xz"));
+    EXPECT_FALSE(code.checkExtremalVertex(138, "-xz"));
 }
 
 TEST(localFlip, flips_correctly_one_and_twice)
@@ -242,9 +224,9 @@ TEST(localFlip, flips_correctly_one_and_twice)
     int l = 8;
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
-    vint vs = {0, 72, 512, 519};
+    vint vs = {0, 36, 256, 263};
     code.localFlip(vs);
-    std::vector<int8_t> &flipBits = code.getFlipBits();
+    BitVector &flipBits = code.getFlipBits();
     EXPECT_EQ(flipBits[0], 1);
     code.localFlip(vs);
     for (const int value : flipBits)
@@ -262,98 +244,98 @@ TEST(findSweepEdges, correct_edges_one_error)
     code.calculateSyndrome();
 
     // Full vertex
-    vstr upEdgesInSynd = code.findSweepEdges(40, "xyz");
+    vstr upEdgesInSynd = code.findSweepEdges(20, "xyz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "xyz") != upEdgesInSynd.end());
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 2);
 
-    upEdgesInSynd = code.findSweepEdges(40, "yz");
+    upEdgesInSynd = code.findSweepEdges(20, "yz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "xyz") != upEdgesInSynd.end());
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 2);
 
-    upEdgesInSynd = code.findSweepEdges(40, "xz");
+    upEdgesInSynd = code.findSweepEdges(20, "xz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "xyz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 1);
 
-    upEdgesInSynd = code.findSweepEdges(40, "xy");
+    upEdgesInSynd = code.findSweepEdges(20, "xy");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "xyz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 1);
 
-    upEdgesInSynd = code.findSweepEdges(40, "-xy");
+    upEdgesInSynd = code.findSweepEdges(20, "-xy");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 1);
 
-    upEdgesInSynd = code.findSweepEdges(40, "-xz");
+    upEdgesInSynd = code.findSweepEdges(20, "-xz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 1);
 
-    upEdgesInSynd = code.findSweepEdges(40, "-xyz");
+    upEdgesInSynd = code.findSweepEdges(20, "-xyz");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
-    upEdgesInSynd = code.findSweepEdges(40, "-yz");
+    upEdgesInSynd = code.findSweepEdges(20, "-yz");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
     // Type 1 half vertex
-    upEdgesInSynd = code.findSweepEdges(104, "xyz");
+    upEdgesInSynd = code.findSweepEdges(72, "xyz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 1);
 
-    upEdgesInSynd = code.findSweepEdges(104, "yz");
+    upEdgesInSynd = code.findSweepEdges(72, "yz");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
-    upEdgesInSynd = code.findSweepEdges(104, "xz");
+    upEdgesInSynd = code.findSweepEdges(72, "xz");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
-    upEdgesInSynd = code.findSweepEdges(104, "xy");
+    upEdgesInSynd = code.findSweepEdges(72, "xy");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
-    upEdgesInSynd = code.findSweepEdges(104, "-xy");
+    upEdgesInSynd = code.findSweepEdges(72, "-xy");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "-xyz") != upEdgesInSynd.end());
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 2);
 
-    upEdgesInSynd = code.findSweepEdges(104, "-xz");
+    upEdgesInSynd = code.findSweepEdges(72, "-xz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "-xyz") != upEdgesInSynd.end());
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 2);
 
-    upEdgesInSynd = code.findSweepEdges(104, "-xyz");
+    upEdgesInSynd = code.findSweepEdges(72, "-xyz");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
-    upEdgesInSynd = code.findSweepEdges(104, "-yz");
+    upEdgesInSynd = code.findSweepEdges(72, "-yz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "-xyz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 1);
 
     // Type 2 half vertex
-    upEdgesInSynd = code.findSweepEdges(107, "xyz");
+    upEdgesInSynd = code.findSweepEdges(75, "xyz");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
-    upEdgesInSynd = code.findSweepEdges(107, "yz");
+    upEdgesInSynd = code.findSweepEdges(75, "yz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "xyz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 1);
 
-    upEdgesInSynd = code.findSweepEdges(107, "xz");
+    upEdgesInSynd = code.findSweepEdges(75, "xz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "xyz") != upEdgesInSynd.end());
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "-yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 2);
 
-    upEdgesInSynd = code.findSweepEdges(107, "xy");
+    upEdgesInSynd = code.findSweepEdges(75, "xy");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "xyz") != upEdgesInSynd.end());
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "-yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 2);
 
-    upEdgesInSynd = code.findSweepEdges(107, "-xy");
+    upEdgesInSynd = code.findSweepEdges(75, "-xy");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
-    upEdgesInSynd = code.findSweepEdges(107, "-xz");
+    upEdgesInSynd = code.findSweepEdges(75, "-xz");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 
-    upEdgesInSynd = code.findSweepEdges(107, "-xyz");
+    upEdgesInSynd = code.findSweepEdges(75, "-xyz");
     EXPECT_TRUE(std::find(upEdgesInSynd.begin(), upEdgesInSynd.end(), "-yz") != upEdgesInSynd.end());
     EXPECT_EQ(upEdgesInSynd.size(), 1);
 
-    upEdgesInSynd = code.findSweepEdges(107, "-yz");
+    upEdgesInSynd = code.findSweepEdges(75, "-yz");
     EXPECT_EQ(upEdgesInSynd.size(), 0);
 }
 
@@ -364,24 +346,24 @@ TEST(faceVertices, handles_valid_input)
     RhombicCode code(l, p, p, false, 1);
 
     // Full vertex
-    vint expectedVertices = {86, 93, 266, 302};
-    EXPECT_EQ(code.faceVertices(86, {"xyz", "xy", "xy"}), expectedVertices);
-    EXPECT_EQ(code.faceVertices(86, {"xy", "xyz", "xyz"}), expectedVertices);
+    vint expectedVertices = {43, 46, 158, 194};
+    EXPECT_EQ(code.faceVertices(43, {"xyz", "xy", "xy"}), expectedVertices);
+    EXPECT_EQ(code.faceVertices(43, {"xy", "xyz", "xyz"}), expectedVertices);
 
     // Full vertex
-    expectedVertices = {86, 91, 265, 301};
-    EXPECT_EQ(code.faceVertices(86, {"-xz", "yz", "yz"}), expectedVertices);
-    EXPECT_EQ(code.faceVertices(86, {"yz", "-xz", "-xz"}), expectedVertices);
+    expectedVertices = {43, 45, 157, 193};
+    EXPECT_EQ(code.faceVertices(43, {"-xz", "yz", "yz"}), expectedVertices);
+    EXPECT_EQ(code.faceVertices(43, {"yz", "-xz", "-xz"}), expectedVertices);
 
     // Half Vertex Type 1
-    expectedVertices = {172, 209, 382, 388};
-    EXPECT_EQ(code.faceVertices(388, {"xz", "-xyz", "-xyz"}), expectedVertices);
-    EXPECT_EQ(code.faceVertices(388, {"-xyz", "xz", "xz"}), expectedVertices);
+    expectedVertices = {86, 104, 274, 280};
+    EXPECT_EQ(code.faceVertices(280, {"xz", "-xyz", "-xyz"}), expectedVertices);
+    EXPECT_EQ(code.faceVertices(280, {"-xyz", "xz", "xz"}), expectedVertices);
 
     // Half Vertex Type 2
-    expectedVertices = {135, 165, 344, 345};
-    EXPECT_EQ(code.faceVertices(345, {"-xz", "-xy", "-xy"}), expectedVertices);
-    EXPECT_EQ(code.faceVertices(345, {"-xy", "-xz", "-xz"}), expectedVertices);
+    expectedVertices = {67, 82, 236, 237};
+    EXPECT_EQ(code.faceVertices(237, {"-xz", "-xy", "-xy"}), expectedVertices);
+    EXPECT_EQ(code.faceVertices(237, {"-xy", "-xz", "-xz"}), expectedVertices);
 }
 
 TEST(faceVertices, excepts_too_many_directions)
@@ -417,11 +399,11 @@ TEST(sweepFullVertex, handles_qubits_errors_xy)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xy -xz face of vertex 27
+    // xy -xz face of vertex 13
     code.setError({81});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    auto sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     auto &flipBits = code.getFlipBits();
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -434,13 +416,13 @@ TEST(sweepFullVertex, handles_qubits_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy xyz face of vertex 27
+    // xy xyz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({80});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 80)
@@ -452,13 +434,13 @@ TEST(sweepFullVertex, handles_qubits_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy -yz face of vertex 27
+    // xy -yz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({82});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 82)
@@ -472,13 +454,13 @@ TEST(sweepFullVertex, handles_qubits_errors_xy)
     }
 
     // Two Errors
-    // xy -yz and xy -xz faces of vertex 27
+    // xy -yz and xy -xz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({81, 82});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 81 || i == 82)
@@ -490,13 +472,13 @@ TEST(sweepFullVertex, handles_qubits_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy -yz and xy xyz faces of vertex 27
+    // xy -yz and xy xyz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({80, 82});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 80 || i == 82)
@@ -508,13 +490,13 @@ TEST(sweepFullVertex, handles_qubits_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy -xz and xy xyz faces of vertex 27
+    // xy -xz and xy xyz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({80, 81});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 80 || i == 81)
@@ -528,13 +510,13 @@ TEST(sweepFullVertex, handles_qubits_errors_xy)
     }
 
     // Three errors
-    // xy -xz, xy xyz and xy -yz faces of vertex 27
+    // xy -xz, xy xyz and xy -yz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({80, 81, 82});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 80 || i == 81 || i == 82)
@@ -555,16 +537,16 @@ TEST(sweepFullVertex, handles_measurement_errors_xy)
     RhombicCode code(l, p, p, false, 1);
 
     // 3 sweep edges around vertex
-    // xy, xyz, -yz edges of vertex 27
+    // xy, xyz, -yz edges of vertex 13
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[189] = 1;
-    syndrome[191] = 1;
-    syndrome[501] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[104] = 1;
+    syndrome[105] = 1;
+    syndrome[111] = 1;
     code.setSyndrome(syndrome);
-    vstr sweepEdges = code.findSweepEdges(27, "xy");
-    std::vector<int8_t> &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    vstr sweepEdges = code.findSweepEdges(13, "xy");
+    BitVector &flipBits = code.getFlipBits();
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     EXPECT_TRUE(flipBits[80] ^ flipBits[82]);
     // std::cout << "80 = " << flipBits[80] << ", 82 = " << flipBits[82] << std::endl;
     // std::cout << "XOR = " << (flipBits[80] ^ flipBits[82]) << std::endl;
@@ -578,15 +560,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy, -xz, -yz edges of vertex 27
+    // xy, -xz, -yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[501] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[111] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     EXPECT_TRUE(flipBits[81] ^ flipBits[82]);
     // std::cout << "80 = " << flipBits[81] << ", 82 = " << flipBits[82] << std::endl;
     // std::cout << "XOR = " << (flipBits[81] ^ flipBits[82]) << std::endl;
@@ -600,15 +582,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy, xyz, -xz edges of vertex 27
+    // xy, xyz, -xz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[189] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[104] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     EXPECT_TRUE(flipBits[80] ^ flipBits[81]);
     // std::cout << "80 = " << flipBits[80] << ", 81 = " << flipBits[81] << std::endl;
     // std::cout << "XOR = " << (flipBits[80] ^ flipBits[81]) << std::endl;
@@ -622,15 +604,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz, -xz, -yz edges of vertex 27
+    // xyz, -xz, -yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[501] = 1;
-    syndrome[189] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[111] = 1;
+    syndrome[104] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xy");
-    code.sweepFullVertex(27, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xy");
+    code.sweepFullVertex(13, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     EXPECT_TRUE((flipBits[80] && flipBits[81]) ^
                 (flipBits[80] && flipBits[82]) ^
                 (flipBits[81] && flipBits[82]));
@@ -654,11 +636,11 @@ TEST(sweepHalfVertex, handles_qubit_errors_xy)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xyx -xz face of vertex 283
+    // xyx -xz face of vertex 175
     code.setError({109});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(283, "xy");
-    code.sweepHalfVertex(283, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    auto sweepEdges = code.findSweepEdges(175, "xy");
+    code.sweepHalfVertex(175, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     auto &flipBits = code.getFlipBits();
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -671,13 +653,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyx -yz face of vertex 283
+    // xyx -yz face of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({204});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xy");
-    code.sweepHalfVertex(283, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xy");
+    code.sweepHalfVertex(175, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 204)
@@ -689,13 +671,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz -yz face of vertex 283
+    // -xz -yz face of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({113});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xy");
-    code.sweepHalfVertex(283, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xy");
+    code.sweepHalfVertex(175, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 113)
@@ -709,13 +691,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xy)
     }
 
     // Two errors
-    // xyz -xz, -xz -yz faces of vertex 283
+    // xyz -xz, -xz -yz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({109, 113});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xy");
-    code.sweepHalfVertex(283, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xy");
+    code.sweepHalfVertex(175, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 204)
@@ -727,13 +709,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz -xz, xyz -yz faces of vertex 283
+    // xyz -xz, xyz -yz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({109, 204});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xy");
-    code.sweepHalfVertex(283, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xy");
+    code.sweepHalfVertex(175, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 113)
@@ -745,13 +727,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz -yz, -xz -yz faces of vertex 283
+    // xyz -yz, -xz -yz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({113, 204});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xy");
-    code.sweepHalfVertex(283, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xy");
+    code.sweepHalfVertex(175, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 109)
@@ -771,16 +753,16 @@ TEST(sweepHalfVertex, handles_measurement_errors_xy)
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
 
-    // Three sweep edges at vertex 283
+    // Three sweep edges at vertex 175
     // xyz, -yz and -xz edges
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[1981] = 1;
-    syndrome[480] = 1;
-    syndrome[265] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[300] = 1;
+    syndrome[275] = 1;
+    syndrome[146] = 1;
     code.setSyndrome(syndrome);
-    auto sweepEdges = code.findSweepEdges(283, "xy");
-    code.sweepHalfVertex(283, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
+    auto sweepEdges = code.findSweepEdges(175, "xy");
+    code.sweepHalfVertex(175, sweepEdges, "xy", {"xyz", "-xz", "-yz"});
     auto &flipBits = code.getFlipBits();
     EXPECT_TRUE(flipBits[109] ^ flipBits[113] ^ flipBits[204]);
     // std::cout << "109 = " << flipBits[109] << ", 113 = " << flipBits[113] << ", 204 = " << flipBits[204] << std::endl;
@@ -944,13 +926,13 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xy)
     // 3 sweep edges around vertex
     // -xy, xz, -xyz edges of vertex 0
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[555] = 1;
-    syndrome[6] = 1;
-    syndrome[889] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[5] = 1;
+    syndrome[2] = 1;
+    syndrome[4] = 1;
     code.setSyndrome(syndrome);
     vstr sweepEdges = code.findSweepEdges(0, "-xy");
-    std::vector<int8_t> &flipBits = code.getFlipBits();
+    BitVector &flipBits = code.getFlipBits();
     code.sweepFullVertex(0, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
     EXPECT_TRUE(flipBits[44] ^ flipBits[87]);
     for (int i = 0; i < flipBits.size(); ++i)
@@ -963,12 +945,12 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xy, -xyz, yz edges of vertex 27
+    // -xy, -xyz, yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[555] = 1;
-    syndrome[889] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[5] = 1;
     syndrome[4] = 1;
+    syndrome[3] = 1;
     code.setSyndrome(syndrome);
     sweepEdges = code.findSweepEdges(0, "-xy");
     code.sweepFullVertex(0, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
@@ -983,12 +965,12 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xy, yz, xz edges of vertex 27
+    // -xy, yz, xz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[555] = 1;
-    syndrome[4] = 1;
-    syndrome[6] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[5] = 1;
+    syndrome[3] = 1;
+    syndrome[2] = 1;
     code.setSyndrome(syndrome);
     sweepEdges = code.findSweepEdges(0, "-xy");
     code.sweepFullVertex(0, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
@@ -1003,12 +985,12 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xyz, xz, yz edges of vertex 27
+    // -xyz, xz, yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[889] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
     syndrome[4] = 1;
-    syndrome[6] = 1;
+    syndrome[3] = 1;
+    syndrome[2] = 1;
     code.setSyndrome(syndrome);
     sweepEdges = code.findSweepEdges(0, "-xy");
     code.sweepFullVertex(0, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
@@ -1034,12 +1016,12 @@ TEST(sweepFullVertex, handles_qubit_errors_xz)
     RhombicCode code(l, p, p, false, 1);
 
     // Two errors
-    // xy -yz and xy xyz faces of vertex 27
+    // xy -yz and xy xyz faces of vertex 13
     code.setError({80, 82});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(27, "xz");
+    auto sweepEdges = code.findSweepEdges(13, "xz");
     auto &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 79 || i == 83)
@@ -1051,13 +1033,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz -yz and xz -xy faces of vertex 27
+    // xz -yz and xz -xy faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({83, 117});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 83 || i == 117)
@@ -1069,13 +1051,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz xyz and xz -xy faces of vertex 27
+    // xz xyz and xz -xy faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({79, 117});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 79 || i == 117)
@@ -1089,13 +1071,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xz)
     }
 
     // One error
-    // xz -yz face of vertex 27
+    // xz -yz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({83});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 83)
@@ -1107,13 +1089,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz xyz face of vertex 27
+    // xz xyz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({79});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 79)
@@ -1125,13 +1107,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz -xy face of vertex 27
+    // xz -xy face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({117});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 117)
@@ -1145,13 +1127,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xz)
     }
 
     // Three errors
-    // xz -xy, xz -yz, xz xyz faces of vertex 27
+    // xz -xy, xz -yz, xz xyz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({79, 83, 117});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 79 || i == 83 || i == 117)
@@ -1172,16 +1154,16 @@ TEST(sweepFullVertex, handles_measurement_errors_xz)
     RhombicCode code(l, p, p, false, 1);
 
     // 3 sweep edges around vertex
-    // xz, xyz, -yz edges of vertex 27
+    // xz, xyz, -yz edges of vertex 13
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[189] = 1;
-    syndrome[195] = 1;
-    syndrome[501] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[104] = 1;
+    syndrome[106] = 1;
+    syndrome[111] = 1;
     code.setSyndrome(syndrome);
-    vstr sweepEdges = code.findSweepEdges(27, "xz");
-    std::vector<int8_t> &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    vstr sweepEdges = code.findSweepEdges(13, "xz");
+    BitVector &flipBits = code.getFlipBits();
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     EXPECT_TRUE(flipBits[79] ^ flipBits[83]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1193,15 +1175,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // // xz, -xy, -yz edges of vertex 27
+    // // xz, -xy, -yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[195] = 1;
-    syndrome[501] = 1;
-    syndrome[604] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[106] = 1;
+    syndrome[111] = 1;
+    syndrome[109] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     EXPECT_TRUE(flipBits[83] ^ flipBits[117]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1213,15 +1195,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // // xz, xyz, -xy edges of vertex 27
+    // // xz, xyz, -xy edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[195] = 1;
-    syndrome[189] = 1;
-    syndrome[604] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[106] = 1;
+    syndrome[104] = 1;
+    syndrome[109] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     EXPECT_TRUE(flipBits[79] ^ flipBits[117]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1233,15 +1215,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz, -xy, -yz edges of vertex 27
+    // xyz, -xy, -yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[501] = 1;
-    syndrome[189] = 1;
-    syndrome[604] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[111] = 1;
+    syndrome[104] = 1;
+    syndrome[109] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xz");
-    code.sweepFullVertex(27, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "xz");
+    code.sweepFullVertex(13, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     EXPECT_TRUE((flipBits[79] && flipBits[83]) ^
                 (flipBits[79] && flipBits[117]) ^
                 (flipBits[83] && flipBits[117]));
@@ -1264,12 +1246,12 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xz)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xy -xz face of vertex 27
+    // xy -xz face of vertex 13
     code.setError({81});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(27, "-xz");
+    auto sweepEdges = code.findSweepEdges(13, "-xz");
     auto &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 81)
@@ -1281,13 +1263,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz yz face of vertex 27
+    // -xz yz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({95});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 95)
@@ -1299,13 +1281,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz -xyz face of vertex 27
+    // -xz -xyz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({31});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 31)
@@ -1319,13 +1301,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xz)
     }
 
     // Two errors
-    // -xz xy and -xz yz faces of vertex 27
+    // -xz xy and -xz yz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({81, 95});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 81 || i == 95)
@@ -1337,13 +1319,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz xy and -xz -xyz faces of vertex 27
+    // -xz xy and -xz -xyz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({31, 81});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 31 || i == 81)
@@ -1355,13 +1337,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz yz and -xz -xyz faces of vertex 27
+    // -xz yz and -xz -xyz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({31, 95});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 31 || i == 95)
@@ -1375,13 +1357,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xz)
     }
 
     // Three errors
-    // -xz yx, -xz xy and -xz -xyz faces of vertex 27
+    // -xz yx, -xz xy and -xz -xyz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({31, 81, 95});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 31 || i == 81 || i == 95)
@@ -1402,16 +1384,16 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xz)
     RhombicCode code(l, p, p, false, 1);
 
     // 3 sweep edges around vertex
-    // -xz, -xyz, yz edges of vertex 27
+    // -xz, -xyz, yz edges of vertex 13
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[193] = 1;
-    syndrome[490] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[107] = 1;
+    syndrome[108] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    vstr sweepEdges = code.findSweepEdges(27, "-xz");
-    std::vector<int8_t> &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    vstr sweepEdges = code.findSweepEdges(13, "-xz");
+    BitVector &flipBits = code.getFlipBits();
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     EXPECT_TRUE(flipBits[31] ^ flipBits[95]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1423,15 +1405,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // // -xz, xy, yz edges of vertex 27
+    // // -xz, xy, yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[193] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[107] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     EXPECT_TRUE(flipBits[81] ^ flipBits[95]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1443,15 +1425,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // // -xz, -xyz, xy edges of vertex 27
+    // // -xz, -xyz, xy edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[490] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[108] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     EXPECT_TRUE(flipBits[31] ^ flipBits[81]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1463,15 +1445,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xyz, xy, yz edges of vertex 27
+    // -xyz, xy, yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[193] = 1;
-    syndrome[490] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[107] = 1;
+    syndrome[108] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-xz");
-    code.sweepFullVertex(27, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(13, "-xz");
+    code.sweepFullVertex(13, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     EXPECT_TRUE((flipBits[81] && flipBits[95]) ^
                 (flipBits[81] && flipBits[31]) ^
                 (flipBits[95] && flipBits[31]));
@@ -1494,12 +1476,12 @@ TEST(sweepFullVertex, handles_qubit_errors_yz)
     RhombicCode code(l, p, p, false, 1);
 
     // Two errors
-    // xy -xz and xy xyz faces of vertex 27
+    // xy -xz and xy xyz faces of vertex 13
     code.setError({80, 81});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(27, "yz");
+    auto sweepEdges = code.findSweepEdges(13, "yz");
     auto &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 78 || i == 95)
@@ -1511,13 +1493,13 @@ TEST(sweepFullVertex, handles_qubit_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz -xy and yz -xz faces of vertex 27
+    // yz -xy and yz -xz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({130, 95});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 130 || i == 95)
@@ -1529,13 +1511,13 @@ TEST(sweepFullVertex, handles_qubit_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz -xy and yz xyz faces of vertex 27
+    // yz -xy and yz xyz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({130, 78});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 130 || i == 78)
@@ -1549,13 +1531,13 @@ TEST(sweepFullVertex, handles_qubit_errors_yz)
     }
 
     // One error
-    // yz xyz face of vertex 27
+    // yz xyz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({78});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 78)
@@ -1567,13 +1549,13 @@ TEST(sweepFullVertex, handles_qubit_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz -xy face of vertex 27
+    // yz -xy face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({130});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 130)
@@ -1585,13 +1567,13 @@ TEST(sweepFullVertex, handles_qubit_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz -xz face of vertex 27
+    // yz -xz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({95});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 95)
@@ -1605,13 +1587,13 @@ TEST(sweepFullVertex, handles_qubit_errors_yz)
     }
 
     // Three errors
-    // yz -xy, yz -xz and yz xyz faces of vertex 27
+    // yz -xy, yz -xz and yz xyz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({130, 78, 95});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 130 || i == 78 || i == 95)
@@ -1632,16 +1614,16 @@ TEST(sweepFullVertex, handles_measurement_errors_yz)
     RhombicCode code(l, p, p, false, 1);
 
     // 3 sweep edges around vertex
-    // -xz, xyz, yz edges of vertex 27
+    // -xz, xyz, yz edges of vertex 13
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[193] = 1;
-    syndrome[189] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[107] = 1;
+    syndrome[104] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    vstr sweepEdges = code.findSweepEdges(27, "yz");
-    std::vector<int8_t> &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    vstr sweepEdges = code.findSweepEdges(13, "yz");
+    BitVector &flipBits = code.getFlipBits();
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     EXPECT_TRUE(flipBits[78] ^ flipBits[95]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1653,15 +1635,15 @@ TEST(sweepFullVertex, handles_measurement_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz, -xy, yz edges of vertex 27
+    // -xz, -xy, yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[604] = 1;
-    syndrome[193] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[109] = 1;
+    syndrome[107] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     EXPECT_TRUE(flipBits[130] ^ flipBits[95]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1673,15 +1655,15 @@ TEST(sweepFullVertex, handles_measurement_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz, xyz, -xy edges of vertex 27
+    // yz, xyz, -xy edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[193] = 1;
-    syndrome[189] = 1;
-    syndrome[604] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[107] = 1;
+    syndrome[104] = 1;
+    syndrome[109] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     EXPECT_TRUE(flipBits[130] ^ flipBits[78]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1693,15 +1675,15 @@ TEST(sweepFullVertex, handles_measurement_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz, -xy, -xz edges of vertex 27
+    // xyz, -xy, -xz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[189] = 1;
-    syndrome[524] = 1;
-    syndrome[604] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[104] = 1;
+    syndrome[110] = 1;
+    syndrome[109] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "yz");
-    code.sweepFullVertex(27, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "yz");
+    code.sweepFullVertex(13, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     EXPECT_TRUE((flipBits[78] && flipBits[95]) ^
                 (flipBits[78] && flipBits[130]) ^
                 (flipBits[95] && flipBits[130]));
@@ -1724,12 +1706,12 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_yz)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xy -yz face of vertex 27
+    // xy -yz face of vertex 13
     code.setError({82});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(27, "-yz");
+    auto sweepEdges = code.findSweepEdges(13, "-yz");
     auto &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 82)
@@ -1741,13 +1723,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz xz face of vertex 27
+    // -yz xz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({83});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 83)
@@ -1759,13 +1741,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz -xyz face of vertex 27
+    // -yz -xyz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({18});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 18)
@@ -1779,13 +1761,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_yz)
     }
 
     // Two errors
-    // -yz xz and -yz xy face of vertex 27
+    // -yz xz and -yz xy face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({83, 82});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 83 || i == 82)
@@ -1797,13 +1779,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz xz and -yz -xyz face of vertex 27
+    // -yz xz and -yz -xyz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({83, 18});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 83 || i == 18)
@@ -1815,13 +1797,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz -xyz and -yz xy face of vertex 27
+    // -yz -xyz and -yz xy face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({82, 18});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 18 || i == 82)
@@ -1835,13 +1817,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_yz)
     }
 
     // Three errors
-    // -yz xz, -yz -xyz and -yz xy face of vertex 27
+    // -yz xz, -yz -xyz and -yz xy face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({83, 82, 18});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 83 || i == 82 || i == 18)
@@ -1862,16 +1844,16 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_yz)
     RhombicCode code(l, p, p, false, 1);
 
     // 3 sweep edges around vertex
-    // xz, -xyz, -yz edges of vertex 27
+    // xz, -xyz, -yz edges of vertex 13
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[195] = 1;
-    syndrome[501] = 1;
-    syndrome[490] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[106] = 1;
+    syndrome[111] = 1;
+    syndrome[108] = 1;
     code.setSyndrome(syndrome);
-    vstr sweepEdges = code.findSweepEdges(27, "-yz");
-    std::vector<int8_t> &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    vstr sweepEdges = code.findSweepEdges(13, "-yz");
+    BitVector &flipBits = code.getFlipBits();
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     EXPECT_TRUE(flipBits[83] ^ flipBits[18]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1883,15 +1865,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz, xy, -yz edges of vertex 27
+    // xz, xy, -yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[195] = 1;
-    syndrome[501] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[106] = 1;
+    syndrome[111] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     EXPECT_TRUE(flipBits[82] ^ flipBits[83]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1903,15 +1885,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz, -xyz, xy edges of vertex 27
+    // -yz, -xyz, xy edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[490] = 1;
-    syndrome[501] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[108] = 1;
+    syndrome[111] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     EXPECT_TRUE(flipBits[82] ^ flipBits[18]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -1923,15 +1905,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz, -xy, -xz edges of vertex 27
+    // xyz, -xy, -xz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[195] = 1;
-    syndrome[490] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[106] = 1;
+    syndrome[108] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-yz");
-    code.sweepFullVertex(27, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(13, "-yz");
+    code.sweepFullVertex(13, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     EXPECT_TRUE((flipBits[18] && flipBits[82]) ^
                 (flipBits[18] && flipBits[83]) ^
                 (flipBits[82] && flipBits[83]));
@@ -1954,12 +1936,12 @@ TEST(sweepFullVertex, handles_qubit_errors_xyz)
     RhombicCode code(l, p, p, false, 1);
 
     // One Error
-    // xy xyz face of vertex 27
+    // xy xyz face of vertex 13
     code.setError({80});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(27, "xyz");
+    auto sweepEdges = code.findSweepEdges(13, "xyz");
     auto &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "yz", "xz"});
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "yz", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 80)
@@ -1971,13 +1953,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz xyz face of vertex 27
+    // xz xyz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({79});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "yz", "xz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "yz", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 79)
@@ -1989,13 +1971,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz xyz face of vertex 27
+    // yz xyz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({78});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "yz", "xz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "yz", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 78)
@@ -2009,13 +1991,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xyz)
     }
 
     // Two errors
-    // xyz xy and xyz yz faces of vertex 27
+    // xyz xy and xyz yz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({78, 80});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "yz", "xz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "yz", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 78 || i == 80)
@@ -2027,13 +2009,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz xy and xyz xz faces of vertex 27
+    // xyz xy and xyz xz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({78, 79});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "yz", "xz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "yz", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 78 || i == 79)
@@ -2045,13 +2027,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz xz and xyz yz faces of vertex 27
+    // xyz xz and xyz yz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({79, 80});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "yz", "xz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "yz", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 79 || i == 80)
@@ -2064,13 +2046,13 @@ TEST(sweepFullVertex, handles_qubit_errors_xyz)
         }
     }
     // Three errors
-    // xyz xy, xyz xz and xyz yz faces of vertex 27
+    // xyz xy, xyz xz and xyz yz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({78, 80, 79});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "yz", "xz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "yz", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 78 || i == 80 || i == 79)
@@ -2091,16 +2073,16 @@ TEST(sweepFullVertex, handles_measurement_errors_xyz)
     RhombicCode code(l, p, p, false, 1);
 
     // 3 sweep edges around vertex
-    // xyz, yz and xz edges of vertex 27
+    // xyz, yz and xz edges of vertex 13
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[189] = 1;
-    syndrome[193] = 1;
-    syndrome[195] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[104] = 1;
+    syndrome[107] = 1;
+    syndrome[106] = 1;
     code.setSyndrome(syndrome);
-    vstr sweepEdges = code.findSweepEdges(27, "xyz");
-    std::vector<int8_t> &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    vstr sweepEdges = code.findSweepEdges(13, "xyz");
+    BitVector &flipBits = code.getFlipBits();
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "xz", "yz"});
     EXPECT_TRUE(flipBits[78] ^ flipBits[79]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -2112,15 +2094,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz, xy, yz edges of vertex 27
+    // xyz, xy, yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[189] = 1;
-    syndrome[193] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[104] = 1;
+    syndrome[107] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "xz", "yz"});
     EXPECT_TRUE(flipBits[80] ^ flipBits[78]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -2132,15 +2114,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz, xy, xz edges of vertex 27
+    // xyz, xy, xz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[189] = 1;
-    syndrome[195] = 1;
-    syndrome[191] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[104] = 1;
+    syndrome[106] = 1;
+    syndrome[105] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "xz", "yz"});
     EXPECT_TRUE(flipBits[79] ^ flipBits[80]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -2152,15 +2134,15 @@ TEST(sweepFullVertex, handles_measurement_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz, xy, xz edges of vertex 27
+    // yz, xy, xz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[191] = 1;
-    syndrome[195] = 1;
-    syndrome[193] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[105] = 1;
+    syndrome[106] = 1;
+    syndrome[107] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "xyz");
-    code.sweepFullVertex(27, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(13, "xyz");
+    code.sweepFullVertex(13, sweepEdges, "xyz", {"xy", "xz", "yz"});
     EXPECT_TRUE((flipBits[78] && flipBits[79]) ^
                 (flipBits[78] && flipBits[80]) ^
                 (flipBits[79] && flipBits[80]));
@@ -2183,12 +2165,12 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xyz)
     RhombicCode code(l, p, p, false, 1);
 
     // Two Errors
-    // xy -yz and xy -xz faces of vertex 27
+    // xy -yz and xy -xz faces of vertex 13
     code.setError({81, 82});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(27, "-xyz");
+    auto sweepEdges = code.findSweepEdges(13, "-xyz");
     auto &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 18 || i == 31)
@@ -2200,13 +2182,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xyz -xy and -xyz -xz faces of vertex 27
+    // -xyz -xy and -xyz -xz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({68, 31});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 68 || i == 31)
@@ -2218,13 +2200,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xyz -xy and -xyz -yz faces of vertex 27
+    // -xyz -xy and -xyz -yz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({68, 18});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 68 || i == 18)
@@ -2238,14 +2220,14 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xyz)
     }
 
     // Three errors
-    // -xyz -xy, -xyz -yz and -xyz -xz faces of vertex 27
-    // -xyz -xy and -xyz -xz faces of vertex 27
+    // -xyz -xy, -xyz -yz and -xyz -xz faces of vertex 13
+    // -xyz -xy and -xyz -xz faces of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({68, 31, 18});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 68 || i == 31 || i == 18)
@@ -2259,13 +2241,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xyz)
     }
 
     // One error
-    // -xyz -xy face of vertex 27
+    // -xyz -xy face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({68});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 68)
@@ -2277,13 +2259,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xyz -xz face of vertex 27
+    // -xyz -xz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({31});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 31)
@@ -2295,13 +2277,13 @@ TEST(sweepFullVertex, handles_qubit_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xyz -yz face of vertex 27
+    // -xyz -yz face of vertex 13
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({18});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 18)
@@ -2322,16 +2304,16 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xyz)
     RhombicCode code(l, p, p, false, 1);
 
     // 3 sweep edges around vertex
-    // -xyz, -yz and -xz edges of vertex 27
+    // -xyz, -yz and -xz edges of vertex 13
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[490] = 1;
-    syndrome[501] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[108] = 1;
+    syndrome[111] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    vstr sweepEdges = code.findSweepEdges(27, "-xyz");
-    std::vector<int8_t> &flipBits = code.getFlipBits();
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-xz", "-yz"});
+    vstr sweepEdges = code.findSweepEdges(13, "-xyz");
+    BitVector &flipBits = code.getFlipBits();
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-xz", "-yz"});
     EXPECT_TRUE(flipBits[18] ^ flipBits[31]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -2343,15 +2325,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xyz, -xy, -yz edges of vertex 27
+    // -xyz, -xy, -yz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[490] = 1;
-    syndrome[604] = 1;
-    syndrome[501] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[108] = 1;
+    syndrome[109] = 1;
+    syndrome[111] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-xz", "-yz"});
     EXPECT_TRUE(flipBits[68] ^ flipBits[18]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -2363,15 +2345,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xyz, -xy, -xz edges of vertex 27
+    // -xyz, -xy, -xz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[490] = 1;
-    syndrome[604] = 1;
-    syndrome[524] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[108] = 1;
+    syndrome[109] = 1;
+    syndrome[110] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-xz", "-yz"});
     EXPECT_TRUE(flipBits[68] ^ flipBits[31]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -2383,15 +2365,15 @@ TEST(sweepFullVertex, handles_measurement_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz, -xy, -xz edges of vertex 27
+    // -yz, -xy, -xz edges of vertex 13
     code.clearFlipBits();
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[501] = 1;
-    syndrome[524] = 1;
-    syndrome[604] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[111] = 1;
+    syndrome[110] = 1;
+    syndrome[109] = 1;
     code.setSyndrome(syndrome);
-    sweepEdges = code.findSweepEdges(27, "-xyz");
-    code.sweepFullVertex(27, sweepEdges, "-xyz", {"-xy", "-xz", "-yz"});
+    sweepEdges = code.findSweepEdges(13, "-xyz");
+    code.sweepFullVertex(13, sweepEdges, "-xyz", {"-xy", "-xz", "-yz"});
     EXPECT_TRUE((flipBits[31] && flipBits[18]) ^
                 (flipBits[31] && flipBits[68]) ^
                 (flipBits[18] && flipBits[68]));
@@ -2414,12 +2396,12 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xy)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xz yz face of vertex 309
+    // xz yz face of vertex 201
     code.setError({407});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(309, "-xy");
+    auto sweepEdges = code.findSweepEdges(201, "-xy");
     auto &flipBits = code.getFlipBits();
-    code.sweepHalfVertex(309, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
+    code.sweepHalfVertex(201, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 407)
@@ -2431,13 +2413,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz -xyz face of vertex 309
+    // xz -xyz face of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({277});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xy");
-    code.sweepHalfVertex(309, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xy");
+    code.sweepHalfVertex(201, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 277)
@@ -2449,13 +2431,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz -xyz face of vertex 309
+    // yz -xyz face of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({276});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xy");
-    code.sweepHalfVertex(309, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xy");
+    code.sweepHalfVertex(201, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 276)
@@ -2469,13 +2451,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xy)
     }
 
     // Two errors
-    // xz yz and xz -xyz faces of vertex 309
+    // xz yz and xz -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({407, 277});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xy");
-    code.sweepHalfVertex(309, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xy");
+    code.sweepHalfVertex(201, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 276)
@@ -2487,13 +2469,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz yz and yz -xyz faces of vertex 309
+    // xz yz and yz -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({407, 276});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xy");
-    code.sweepHalfVertex(309, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xy");
+    code.sweepHalfVertex(201, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 277)
@@ -2505,13 +2487,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xy)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz -xyz and yz -xyz faces of vertex 309
+    // xz -xyz and yz -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({277, 276});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xy");
-    code.sweepHalfVertex(309, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xy");
+    code.sweepHalfVertex(201, sweepEdges, "-xy", {"-xyz", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 407)
@@ -2532,12 +2514,12 @@ TEST(sweepHalfVertex, handles_qubit_errors_xz)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xyx -yz face of vertex 283
+    // xyx -yz face of vertex 175
     code.setError({204});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(283, "xz");
+    auto sweepEdges = code.findSweepEdges(175, "xz");
     auto &flipBits = code.getFlipBits();
-    code.sweepHalfVertex(283, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    code.sweepHalfVertex(175, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 204)
@@ -2549,13 +2531,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz -xy face of vertex 283
+    // xyz -xy face of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({308});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xz");
-    code.sweepHalfVertex(283, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xz");
+    code.sweepHalfVertex(175, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 308)
@@ -2567,13 +2549,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz -xy face of vertex 283
+    // -yz -xy face of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({310});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xz");
-    code.sweepHalfVertex(283, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xz");
+    code.sweepHalfVertex(175, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 310)
@@ -2587,13 +2569,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xz)
     }
 
     // Two errors
-    // xyz -xz, -xz -yz faces of vertex 283
+    // xyz -xz, -xz -yz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({109, 113});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xz");
-    code.sweepHalfVertex(283, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xz");
+    code.sweepHalfVertex(175, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 204)
@@ -2605,13 +2587,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz -yz, xyz -xy faces of vertex 283
+    // xyz -yz, xyz -xy faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({204, 308});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xz");
-    code.sweepHalfVertex(283, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xz");
+    code.sweepHalfVertex(175, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 310)
@@ -2623,13 +2605,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz -yz, -xy -yz faces of vertex 283
+    // xyz -yz, -xy -yz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({204, 310});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "xz");
-    code.sweepHalfVertex(283, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    sweepEdges = code.findSweepEdges(175, "xz");
+    code.sweepHalfVertex(175, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 308)
@@ -2650,12 +2632,12 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xz)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xy yz face of vertex 309
+    // xy yz face of vertex 201
     code.setError({406});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(309, "-xz");
+    auto sweepEdges = code.findSweepEdges(201, "-xz");
     auto &flipBits = code.getFlipBits();
-    code.sweepHalfVertex(309, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    code.sweepHalfVertex(201, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 406)
@@ -2667,13 +2649,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy -xyz face of vertex 309
+    // xy -xyz face of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({278});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xz");
-    code.sweepHalfVertex(309, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xz");
+    code.sweepHalfVertex(201, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 278)
@@ -2685,13 +2667,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // yz -xyz face of vertex 309
+    // yz -xyz face of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({276});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xz");
-    code.sweepHalfVertex(309, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xz");
+    code.sweepHalfVertex(201, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 276)
@@ -2705,13 +2687,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xz)
     }
 
     // Two errors
-    // xy yz and xy -xyz faces of vertex 309
+    // xy yz and xy -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({406, 278});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xz");
-    code.sweepHalfVertex(309, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xz");
+    code.sweepHalfVertex(201, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 276)
@@ -2723,13 +2705,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy yz and yz -xyz faces of vertex 309
+    // xy yz and yz -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({406, 276});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xz");
-    code.sweepHalfVertex(309, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xz");
+    code.sweepHalfVertex(201, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 278)
@@ -2741,13 +2723,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy -xyz and yz -xyz faces of vertex 309
+    // xy -xyz and yz -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({278, 276});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-xz");
-    code.sweepHalfVertex(309, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
+    sweepEdges = code.findSweepEdges(201, "-xz");
+    code.sweepHalfVertex(201, sweepEdges, "-xz", {"-xyz", "xy", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 406)
@@ -2768,12 +2750,12 @@ TEST(sweepHalfVertex, handles_qubit_errors_yz)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xyx -xz face of vertex 283
+    // xyx -xz face of vertex 175
     code.setError({109});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(283, "yz");
+    auto sweepEdges = code.findSweepEdges(175, "yz");
     auto &flipBits = code.getFlipBits();
-    code.sweepHalfVertex(283, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    code.sweepHalfVertex(175, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 109)
@@ -2785,13 +2767,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz -xy face of vertex 283
+    // xyz -xy face of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({308});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "yz");
-    code.sweepHalfVertex(283, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "yz");
+    code.sweepHalfVertex(175, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 308)
@@ -2803,13 +2785,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz -xy face of vertex 283
+    // -xz -xy face of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({309});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "yz");
-    code.sweepHalfVertex(283, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "yz");
+    code.sweepHalfVertex(175, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 309)
@@ -2823,13 +2805,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_yz)
     }
 
     // Two errors
-    // xyz -yz, -xz -yz faces of vertex 283
+    // xyz -yz, -xz -yz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({113, 204});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "yz");
-    code.sweepHalfVertex(283, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "yz");
+    code.sweepHalfVertex(175, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 109)
@@ -2841,13 +2823,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xy xyz and xyz -xz faces of vertex 283
+    // -xy xyz and xyz -xz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({308, 109});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "yz");
-    code.sweepHalfVertex(283, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "yz");
+    code.sweepHalfVertex(175, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 309)
@@ -2859,13 +2841,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xyz -xz and -xz -xy faces of vertex 283
+    // xyz -xz and -xz -xy faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({109, 309});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "yz");
-    code.sweepHalfVertex(283, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "yz");
+    code.sweepHalfVertex(175, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 308)
@@ -2886,12 +2868,12 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_yz)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xy xz face of vertex 309
+    // xy xz face of vertex 201
     code.setError({393});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(309, "-yz");
+    auto sweepEdges = code.findSweepEdges(201, "-yz");
     auto &flipBits = code.getFlipBits();
-    code.sweepHalfVertex(309, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    code.sweepHalfVertex(201, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 393)
@@ -2903,13 +2885,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy -xyz face of vertex 309
+    // xy -xyz face of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({278});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-yz");
-    code.sweepHalfVertex(309, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(201, "-yz");
+    code.sweepHalfVertex(201, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 278)
@@ -2921,13 +2903,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz -xyz face of vertex 309
+    // xz -xyz face of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({277});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-yz");
-    code.sweepHalfVertex(309, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(201, "-yz");
+    code.sweepHalfVertex(201, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 277)
@@ -2941,13 +2923,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_yz)
     }
 
     // Two errors
-    // xy xz and xy -xyz faces of vertex 309
+    // xy xz and xy -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({393, 278});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-yz");
-    code.sweepHalfVertex(309, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(201, "-yz");
+    code.sweepHalfVertex(201, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 277)
@@ -2959,13 +2941,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy yz and xz -xyz faces of vertex 309
+    // xy yz and xz -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({393, 277});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-yz");
-    code.sweepHalfVertex(309, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(201, "-yz");
+    code.sweepHalfVertex(201, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 278)
@@ -2977,13 +2959,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_yz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy -xyz and xz -xyz faces of vertex 309
+    // xy -xyz and xz -xyz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({278, 277});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "-yz");
-    code.sweepHalfVertex(309, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    sweepEdges = code.findSweepEdges(201, "-yz");
+    code.sweepHalfVertex(201, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 393)
@@ -3004,12 +2986,12 @@ TEST(sweepHalfVertex, handles_qubit_errors_xyz)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // xy xz face of vertex 309
+    // xy xz face of vertex 201
     code.setError({393});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(309, "xyz");
+    auto sweepEdges = code.findSweepEdges(201, "xyz");
     auto &flipBits = code.getFlipBits();
-    code.sweepHalfVertex(309, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    code.sweepHalfVertex(201, sweepEdges, "xyz", {"xy", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 393)
@@ -3021,13 +3003,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy yz face of vertex 309
+    // xy yz face of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({406});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "xyz");
-    code.sweepHalfVertex(309, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "xyz");
+    code.sweepHalfVertex(201, sweepEdges, "xyz", {"xy", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 406)
@@ -3039,13 +3021,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz yz face of vertex 309
+    // xz yz face of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({407});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "xyz");
-    code.sweepHalfVertex(309, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "xyz");
+    code.sweepHalfVertex(201, sweepEdges, "xyz", {"xy", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 407)
@@ -3059,13 +3041,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xyz)
     }
 
     // Two errors
-    // xy xz and xy yz faces of vertex 309
+    // xy xz and xy yz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({393, 406});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "xyz");
-    code.sweepHalfVertex(309, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "xyz");
+    code.sweepHalfVertex(201, sweepEdges, "xyz", {"xy", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 407)
@@ -3077,13 +3059,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xy xz and xz yz faces of vertex 309
+    // xy xz and xz yz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({393, 407});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "xyz");
-    code.sweepHalfVertex(309, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "xyz");
+    code.sweepHalfVertex(201, sweepEdges, "xyz", {"xy", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 406)
@@ -3095,13 +3077,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // xz yz and xy yz faces of vertex 309
+    // xz yz and xy yz faces of vertex 201
     code.calculateSyndrome();
     code.clearFlipBits();
     code.setError({406, 407});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(309, "xyz");
-    code.sweepHalfVertex(309, sweepEdges, "xyz", {"xy", "xz", "yz"});
+    sweepEdges = code.findSweepEdges(201, "xyz");
+    code.sweepHalfVertex(201, sweepEdges, "xyz", {"xy", "xz", "yz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 393)
@@ -3122,12 +3104,12 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xyz)
     RhombicCode code(l, p, p, false, 1);
 
     // One error
-    // -xz -yz face of vertex 283
+    // -xz -yz face of vertex 175
     code.setError({113});
     code.calculateSyndrome();
-    auto sweepEdges = code.findSweepEdges(283, "-xyz");
+    auto sweepEdges = code.findSweepEdges(175, "-xyz");
     auto &flipBits = code.getFlipBits();
-    code.sweepHalfVertex(283, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    code.sweepHalfVertex(175, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 113)
@@ -3139,13 +3121,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz -xy face of vertex 283
+    // -xz -xy face of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({309});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "-xyz");
-    code.sweepHalfVertex(283, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "-xyz");
+    code.sweepHalfVertex(175, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 309)
@@ -3157,13 +3139,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz -xy face of vertex 283
+    // -yz -xy face of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({310});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "-xyz");
-    code.sweepHalfVertex(283, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "-xyz");
+    code.sweepHalfVertex(175, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 310)
@@ -3177,13 +3159,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xyz)
     }
 
     // Two errors
-    // xyz -xz, xyz -yz faces of vertex 283
+    // xyz -xz, xyz -yz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({109, 204});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "-xyz");
-    code.sweepHalfVertex(283, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "-xyz");
+    code.sweepHalfVertex(175, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 113)
@@ -3195,13 +3177,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -xz -yz and -yz -xy faces of vertex 283
+    // -xz -yz and -yz -xy faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({113, 310});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "-xyz");
-    code.sweepHalfVertex(283, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "-xyz");
+    code.sweepHalfVertex(175, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 309)
@@ -3213,13 +3195,13 @@ TEST(sweepHalfVertex, handles_qubit_errors_minus_xyz)
             EXPECT_EQ(flipBits[i], 0);
         }
     }
-    // -yz -xy and -xy -xz faces of vertex 283
+    // -yz -xy and -xy -xz faces of vertex 175
     code.clearSyndrome();
     code.clearFlipBits();
     code.setError({113, 309});
     code.calculateSyndrome();
-    sweepEdges = code.findSweepEdges(283, "-xyz");
-    code.sweepHalfVertex(283, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    sweepEdges = code.findSweepEdges(175, "-xyz");
+    code.sweepHalfVertex(175, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     for (int i = 0; i < flipBits.size(); ++i)
     {
         if (i == 310)
@@ -3239,17 +3221,17 @@ TEST(sweepHalfVertex, handles_measurement_errors_xz)
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
 
-    // Three sweep edges at vertex 283
+    // Three sweep edges at vertex 175
     // xyz, -yz and -xy edges
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[1981] = 1;
-    syndrome[480] = 1;
-    syndrome[723] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[300] = 1;
+    syndrome[275] = 1;
+    syndrome[409] = 1;
     code.setSyndrome(syndrome);
     auto &flipBits = code.getFlipBits();
-    auto sweepEdges = code.findSweepEdges(283, "xz");
-    code.sweepHalfVertex(283, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
+    auto sweepEdges = code.findSweepEdges(175, "xz");
+    code.sweepHalfVertex(175, sweepEdges, "xz", {"xyz", "-xy", "-yz"});
     EXPECT_TRUE(flipBits[310] ^ flipBits[308] ^ flipBits[204]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -3269,17 +3251,17 @@ TEST(sweepHalfVertex, handles_measurement_errors_yz)
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
 
-    // Three sweep edges at vertex 283
+    // Three sweep edges at vertex 175
     // xyz, -xy and -xz edges
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[1981] = 1;
-    syndrome[723] = 1;
-    syndrome[265] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[300] = 1;
+    syndrome[409] = 1;
+    syndrome[146] = 1;
     code.setSyndrome(syndrome);
     auto &flipBits = code.getFlipBits();
-    auto sweepEdges = code.findSweepEdges(283, "yz");
-    code.sweepHalfVertex(283, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
+    auto sweepEdges = code.findSweepEdges(175, "yz");
+    code.sweepHalfVertex(175, sweepEdges, "yz", {"xyz", "-xy", "-xz"});
     EXPECT_TRUE(flipBits[109] ^ flipBits[308] ^ flipBits[309]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -3299,17 +3281,17 @@ TEST(sweepHalfVertex, handles_measurement_errors_minus_xyz)
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
 
-    // Three sweep edges at vertex 283
+    // Three sweep edges at vertex 175
     // -xy, -yz and -xz edges
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[723] = 1;
-    syndrome[480] = 1;
-    syndrome[265] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[409] = 1;
+    syndrome[275] = 1;
+    syndrome[146] = 1;
     code.setSyndrome(syndrome);
     auto &flipBits = code.getFlipBits();
-    auto sweepEdges = code.findSweepEdges(283, "-xyz");
-    code.sweepHalfVertex(283, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
+    auto sweepEdges = code.findSweepEdges(175, "-xyz");
+    code.sweepHalfVertex(175, sweepEdges, "-xyz", {"-xy", "-yz", "-xz"});
     EXPECT_TRUE(flipBits[113] ^ flipBits[309] ^ flipBits[310]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -3329,17 +3311,17 @@ TEST(sweepHalfVertex, handles_measurement_errors_minus_xy)
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
 
-    // Three sweep edges at vertex 309
+    // Three sweep edges at vertex 201
     // -xyz, yz and xz edges
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[651] = 1;
-    syndrome[2167] = 1;
-    syndrome[2169] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[368] = 1;
+    syndrome[543] = 1;
+    syndrome[526] = 1;
     code.setSyndrome(syndrome);
     auto &flipBits = code.getFlipBits();
-    auto sweepEdges = code.findSweepEdges(309, "-xy");
-    code.sweepHalfVertex(309, sweepEdges, "-xy", {"-xyz", "yz", "xz"});
+    auto sweepEdges = code.findSweepEdges(201, "-xy");
+    code.sweepHalfVertex(201, sweepEdges, "-xy", {"-xyz", "yz", "xz"});
     EXPECT_TRUE(flipBits[276] ^ flipBits[277] ^ flipBits[407]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -3359,17 +3341,17 @@ TEST(sweepHalfVertex, handles_measurement_errors_minus_xz)
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
 
-    // Three sweep edges at vertex 309
+    // Three sweep edges at vertex 201
     // -xyz, yz and xz edges
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[651] = 1;
-    syndrome[2167] = 1;
-    syndrome[2165] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[368] = 1;
+    syndrome[543] = 1;
+    syndrome[405] = 1;
     code.setSyndrome(syndrome);
     auto &flipBits = code.getFlipBits();
-    auto sweepEdges = code.findSweepEdges(309, "-xz");
-    code.sweepHalfVertex(309, sweepEdges, "-xz", {"-xyz", "yz", "xy"});
+    auto sweepEdges = code.findSweepEdges(201, "-xz");
+    code.sweepHalfVertex(201, sweepEdges, "-xz", {"-xyz", "yz", "xy"});
     EXPECT_TRUE(flipBits[276] ^ flipBits[278] ^ flipBits[406]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -3389,17 +3371,17 @@ TEST(sweepHalfVertex, handles_measurement_errors_minus_yz)
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
 
-    // Three sweep edges at vertex 309
+    // Three sweep edges at vertex 201
     // -xyz, yz and xz edges
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[651] = 1;
-    syndrome[2169] = 1;
-    syndrome[2165] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[368] = 1;
+    syndrome[526] = 1;
+    syndrome[405] = 1;
     code.setSyndrome(syndrome);
     auto &flipBits = code.getFlipBits();
-    auto sweepEdges = code.findSweepEdges(309, "-yz");
-    code.sweepHalfVertex(309, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
+    auto sweepEdges = code.findSweepEdges(201, "-yz");
+    code.sweepHalfVertex(201, sweepEdges, "-yz", {"-xyz", "xy", "xz"});
     EXPECT_TRUE(flipBits[277] ^ flipBits[278] ^ flipBits[393]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -3419,17 +3401,17 @@ TEST(sweepHalfVertex, handles_measurement_errors_xyz)
     double p = 0.1;
     RhombicCode code(l, p, p, false, 1);
 
-    // Three sweep edges at vertex 309
+    // Three sweep edges at vertex 201
     // -xyz, yz and xz edges
     std::vector<int8_t> syndrome;
-    syndrome.assign(14 * l * l * l, 0);
-    syndrome[2167] = 1;
-    syndrome[2169] = 1;
-    syndrome[2165] = 1;
+    syndrome.assign(code.getSyndrome().size(), 0);
+    syndrome[543] = 1;
+    syndrome[526] = 1;
+    syndrome[405] = 1;
     code.setSyndrome(syndrome);
     auto &flipBits = code.getFlipBits();
-    auto sweepEdges = code.findSweepEdges(309, "xyz");
-    code.sweepHalfVertex(309, sweepEdges, "xyz", {"xy", "yz", "xz"});
+    auto sweepEdges = code.findSweepEdges(201, "xyz");
+    code.sweepHalfVertex(201, sweepEdges, "xyz", {"xy", "yz", "xz"});
     EXPECT_TRUE(flipBits[406] ^ flipBits[407] ^ flipBits[393]);
     for (int i = 0; i < flipBits.size(); ++i)
     {
@@ -3472,7 +3454,7 @@ TEST(sweep, handles_qubit_errors_xyz)
     EXPECT_TRUE(error.find(151) != error.end());
     for (int i = 0; i < syndrome.size(); ++i)
     {
-        if (i == 811 || i == 357 || i == 363 || i == 107 || i == 105 || i == 555)
+        if (i == 6 || i == 200 || i == 202 || i == 57 || i == 56 || i == 5)
         {
             EXPECT_EQ(syndrome[i], 1);
         }
@@ -3531,7 +3513,7 @@ TEST(sweep, handles_qubit_errors_minus_xyz)
     EXPECT_TRUE(error.find(151) == error.end());
     for (int i = 0; i < syndrome.size(); ++i)
     {
-        if (i == 363 || i == 107 || i == 884 || i == 888)
+        if (i == 202 || i == 57 || i == 205 || i == 62)
         {
             EXPECT_EQ(syndrome[i], 1);
         }
@@ -3589,7 +3571,7 @@ TEST(sweep, handles_qubit_errors_xy)
     EXPECT_TRUE(error.find(151) != error.end());
     for (int i = 0; i < syndrome.size(); ++i)
     {
-        if (i == 357 || i == 811 || i == 889 || i == 363)
+        if (i == 200 || i == 6 || i == 4 || i == 202)
         {
             EXPECT_EQ(syndrome[i], 1);
         }
@@ -3647,7 +3629,7 @@ TEST(sweep, handles_qubit_errors_minus_xy)
     EXPECT_TRUE(error.find(151) == error.end());
     for (int i = 0; i < syndrome.size(); ++i)
     {
-        if (i == 363 || i == 889 || i == 884 || i == 888 || i == 105 || i == 555)
+        if (i == 202 || i == 4 || i == 205 || i == 62 || i == 56 || i == 5)
         {
             EXPECT_EQ(syndrome[i], 1);
         }
@@ -3706,7 +3688,7 @@ TEST(sweep, handles_qubit_errors_xz)
     EXPECT_TRUE(error.find(478) == error.end());
     for (int i = 0; i < syndrome.size(); ++i)
     {
-        if (i == 812 || i == 814 || i == 2326 || i == 2072)
+        if (i == 464 || i == 465 || i == 493 || i == 492)
         {
             EXPECT_EQ(syndrome[i], 1);
         }
@@ -3766,8 +3748,8 @@ TEST(sweep, handles_qubit_errors_minus_xz)
     EXPECT_TRUE(error.find(389) != error.end());
     for (int i = 0; i < syndrome.size(); ++i)
     {
-        if (i == 816 || i == 814 || i == 602 || i == 608 ||
-            i == 2118 || i == 902 || i == 1108 || i == 2317)
+        if (i == 467 || i == 465 || i == 344 || i == 346 ||
+            i == 519 || i == 514 || i == 633 || i == 636)
         {
             EXPECT_EQ(syndrome[i], 1);
         }
@@ -3819,8 +3801,8 @@ TEST(sweep, handles_qubit_errors_yz)
     EXPECT_TRUE(error.find(389) != error.end());
     for (int i = 0; i < syndrome.size(); ++i)
     {
-        if (i == 812 || i == 2071 || i == 602 || i == 2067 ||
-            i == 2118 || i == 902 || i == 1108 || i == 2328)
+        if (i == 464 || i == 470 || i == 344 || i == 349 ||
+            i == 519 || i == 514 || i == 633 || i == 639)
         {
             EXPECT_EQ(syndrome[i], 1);
         }
@@ -3872,7 +3854,7 @@ TEST(sweep, handles_qubit_errors_minus_yz)
     EXPECT_TRUE(error.find(478) == error.end());
     for (int i = 0; i < syndrome.size(); ++i)
     {
-        if (i == 812 || i == 814 || i == 2326 || i == 2072)
+        if (i == 464 || i == 465 || i == 493 || i == 492)
         {
             EXPECT_EQ(syndrome[i], 1);
         }
@@ -4000,4 +3982,36 @@ TEST(sweep, multiple_sweeps_per_syndrome)
         EXPECT_EQ(finalErrorLowRate, finalErrorHighRate);
         EXPECT_EQ(lowRateSyndrome, highRateSyndrome);
     }
-}
\ No newline at end of file
+}
+TEST(sweepStencil, sweeps_like_the_sweep_table)
+{
+    int l = 6;
+    auto geometry = RhombicCode::buildGeometry(l, false);
+    ASSERT_FALSE(geometry->sweepStencil.empty());
+    EXPECT_TRUE(RhombicCode::buildGeometry(l, true)->sweepStencil.empty());
+    auto tableGeometry = std::make_shared<CodeGeometry>(*geometry);
+    tableGeometry->sweepStencil = SweepStencil();
+    tableGeometry->sweepTable = RhombicCode(tableGeometry, 0, 0, 1).buildSweepTable();
+    vdir sweepDirections = {Direction::xyz, Direction::xy, Direction::yz, Direction::xz,
+                            -Direction::xyz, -Direction::xy, -Direction::yz, -Direction::xz};
+    for (const bool greedy : {false, true})
+    {
+        RhombicCode stencilCode(geometry, 0.2, 0.1, 1);
+        RhombicCode tableCode(tableGeometry, 0.2, 0.1, 1);
+        stencilCode.setSeed(1, greedy);
+        tableCode.setSeed(1, greedy);
+        stencilCode.generateDataError(false);
+        tableCode.generateDataError(false);
+        stencilCode.generateMeasError();
+        tableCode.generateMeasError();
+        for (int i = 0; i < 3; ++i)
+        {
+            for (auto &sweepDirection : sweepDirections)
+            {
+                stencilCode.sweep(sweepDirection, greedy);
+                tableCode.sweep(sweepDirection, greedy);
+                EXPECT_EQ(stencilCode.getError().toSet(), tableCode.getError().toSet());
+            }
+        }
+    }
+}
@@ -32,15 +32,17 @@ TEST(neighbour, excepts_outside_lattice)
     int sign = -1;
     std::string direction = "xyz";
     EXPECT_THROW(lattice.neighbour(vertexIndex, direction, sign), std::invalid_argument);
-    std::vector<std::string> directions = {"xy", "xz", "yz"};
+    std::vector<std::string> directions = {"xy", "xz"};
     std::vector<int> signs = {1, -1};
     for (auto const direction : directions)
     {
         EXPECT_THROW(lattice.neighbour(vertexIndex, direction, signs[0]), std::invalid_argument);
         EXPECT_THROW(lattice.neighbour(vertexIndex, direction, signs[1]), std::invalid_argument);
     }
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "yz", -1), std::invalid_argument);
 
-    vertexIndex = 127;
+    vertexIndex = 95;
+    directions = {"xy", "xz", "yz"};
     sign = 1;
     direction = "xyz";
     EXPECT_THROW(lattice.neighbour(vertexIndex, direction, sign), std::invalid_argument);
@@ -60,31 +62,31 @@ TEST(neighbour, handles_valid_input)
     int vertexIndex = 0;
     int sign = 1;
     std::string direction = "xyz";
-    EXPECT_EQ(lattice.neighbour(vertexIndex, direction, sign), 64);
-    vertexIndex = 4;
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", 1), 68);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", 1), 64);
-    vertexIndex = 21;
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", -1), 64);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", -1), 68);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", -1), 65);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", -1), 80);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", 1), 84);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", 1), 69);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, direction, sign), 33);
+    vertexIndex = 2;
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", 1), 36);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", 1), 32);
+    vertexIndex = 10;
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", -1), 32);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", -1), 36);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", -1), 33);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", -1), 48);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", 1), 52);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", 1), 37);
 
     // w = 1 vertices
-    vertexIndex = 127;
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", -1), 63);
     vertexIndex = 95;
     EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", -1), 31);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", -1), 47);
-    vertexIndex = 85;
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", 1), 42);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", 1), 38);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", 1), 41);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", 1), 26);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", -1), 22);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", -1), 25);
+    vertexIndex = 63;
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", -1), 15);
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "xy", -1), std::invalid_argument);
+    vertexIndex = 53;
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "xyz", 1), std::invalid_argument);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", 1), 19);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", 1), 20);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", 1), 13);
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "yz", -1), std::invalid_argument);
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "xz", -1), std::invalid_argument);
 }
 
 TEST(edgeIndex, excepts_edges_beyond_lattice_boundaries)
@@ -96,7 +98,7 @@ TEST(edgeIndex, excepts_edges_beyond_lattice_boundaries)
     int sign = 1;
     EXPECT_THROW(lattice.edgeIndex(vertexIndex, "xy", sign), std::invalid_argument);
 
-    vertexIndex = 127;
+    vertexIndex = 95;
     EXPECT_THROW(lattice.edgeIndex(vertexIndex, "yz", -1), std::invalid_argument);
 }
 
@@ -114,7 +116,7 @@ TEST(edgeIndex, excepts_invalid_signs)
 {
     int l = 4;
     RhombicLattice lattice = RhombicLattice(l);
-    int vertexIndex = 56;
+    int vertexIndex = 28;
     std::string direction = "yz";
     EXPECT_THROW(lattice.edgeIndex(vertexIndex, direction, 0), std::invalid_argument);
     EXPECT_THROW(lattice.edgeIndex(vertexIndex, direction, -0), std::invalid_argument);
@@ -126,15 +128,15 @@ TEST(edgeIndex, handles_valid_input)
 {
     int l = 4;
     RhombicLattice lattice = RhombicLattice(l);
-    int vertexIndex = 42;
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xyz", 1), 294);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xy", 1), 296);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xz", 1), 300);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "yz", 1), 298);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xyz", -1), 595);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xy", -1), 709);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xz", -1), 629);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "yz", -1), 606);
+    int vertexIndex = 21;
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xyz", 1), 168);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xy", 1), 169);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xz", 1), 170);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "yz", 1), 171);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xyz", -1), 172);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xy", -1), 173);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xz", -1), 174);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "yz", -1), 175);
 }
 
 TEST(createFaces, correct_number_of_faces_created)
@@ -180,12 +182,12 @@ TEST(createFaces, correct_faces_created)
     auto &faceToEdges = lattice.getFaceToEdges();
     auto &faceToVertices = lattice.getFaceToVertices();
 
-    vvint expectedVertices = {{16, 21, 64, 80}, {18, 23, 66, 82}, {21, 38, 81, 85}, {21, 36, 80, 84}, {18, 21, 65, 81}, {21, 24, 68, 84}, {23, 26, 70, 86}, {23, 38, 82, 86}, {24, 29, 72, 88}, {24, 41, 84, 88}, {26, 43, 86, 90}, {26, 41, 85, 89}, {26, 31, 74, 90}, {21, 26, 69, 85}, {26, 29, 73, 89}, {33, 38, 81, 97}, {33, 53, 96, 97}, {21, 33, 80, 81}, {33, 36, 80, 96}, {38, 50, 97, 98}, {18, 38, 81, 82}, {38, 58, 101, 102}, {26, 38, 85, 86}, {35, 38, 82, 98}, {38, 41, 85, 101}, {41, 61, 104, 105}, {29, 41, 88, 89}, {41, 53, 100, 101}, {21, 41, 84, 85}, {41, 46, 89, 105}, {36, 41, 84, 100}, {38, 43, 86, 102}, {41, 44, 88, 104}, {43, 46, 90, 106}, {46, 58, 105, 106}, {26, 46, 89, 90}, {48, 53, 96, 112}, {50, 55, 98, 114}, {38, 53, 97, 101}, {36, 53, 96, 100}, {50, 53, 97, 113}, {53, 56, 100, 116}, {55, 58, 102, 118}, {38, 55, 98, 102}, {56, 61, 104, 120}, {41, 56, 100, 104}, {43, 58, 102, 106}, {41, 58, 101, 105}, {58, 63, 106, 122}, {53, 58, 101, 117}, {58, 61, 105, 121}};
+    vvint expectedVertices = {{8, 10, 32, 48}, {9, 11, 34, 50}, {10, 19, 49, 53}, {10, 18, 48, 52}, {9, 10, 33, 49}, {10, 12, 36, 52}, {11, 13, 38, 54}, {11, 19, 50, 54}, {12, 14, 40, 56}, {12, 20, 52, 56}, {13, 21, 54, 58}, {13, 20, 53, 57}, {13, 15, 42, 58}, {10, 13, 37, 53}, {13, 14, 41, 57}, {16, 19, 49, 65}, {16, 26, 64, 65}, {10, 16, 48, 49}, {16, 18, 48, 64}, {19, 25, 65, 66}, {9, 19, 49, 50}, {19, 29, 69, 70}, {13, 19, 53, 54}, {17, 19, 50, 66}, {19, 20, 53, 69}, {20, 30, 72, 73}, {14, 20, 56, 57}, {20, 26, 68, 69}, {10, 20, 52, 53}, {20, 23, 57, 73}, {18, 20, 52, 68}, {19, 21, 54, 70}, {20, 22, 56, 72}, {21, 23, 58, 74}, {23, 29, 73, 74}, {13, 23, 57, 58}, {24, 26, 64, 80}, {25, 27, 66, 82}, {19, 26, 65, 69}, {18, 26, 64, 68}, {25, 26, 65, 81}, {26, 28, 68, 84}, {27, 29, 70, 86}, {19, 27, 66, 70}, {28, 30, 72, 88}, {20, 28, 68, 72}, {21, 29, 70, 74}, {20, 29, 69, 73}, {29, 31, 74, 90}, {26, 29, 69, 85}, {29, 30, 73, 89}};
     for (int i = 0; i < expectedVertices.size(); ++i)
     {
         EXPECT_EQ(faceToVertices[i], expectedVertices[i]);
     }
-    vvint expectedEdges = {{112, 114, 448, 562}, {126, 128, 462, 576}, {147, 153, 567, 601}, {151, 254, 562, 564}, {130, 153, 459, 461}, {151, 174, 480, 482}, {165, 188, 494, 496}, {165, 268, 576, 578}, {168, 170, 504, 618}, {168, 174, 588, 622}, {182, 188, 602, 636}, {186, 289, 597, 599}, {182, 184, 518, 632}, {147, 149, 483, 597}, {186, 209, 515, 517}, {231, 233, 567, 681}, {231, 235, 672, 683}, {153, 233, 562, 566}}; // Next faceIndex = 18
+    vvint expectedEdges = {{64, 65, 84, 85}, {72, 73, 92, 93}, {80, 82, 156, 158}, {83, 85, 145, 151}, {75, 78, 82, 87}, {83, 86, 98, 103}, {91, 94, 106, 111}, {91, 93, 153, 159}, {96, 97, 116, 117}, {96, 98, 164, 166}, {104, 106, 172, 174}, {107, 109, 161, 167}, {104, 105, 124, 125}, {80, 81, 108, 109}, {107, 110, 114, 119}, {128, 129, 156, 157}, {128, 131, 212, 215}, {82, 85, 129, 134}}; // Next faceIndex = 18
     for (int i = 0; i < expectedEdges.size(); ++i)
     {
         EXPECT_EQ(faceToEdges[i], expectedEdges[i]);
@@ -200,8 +202,8 @@ TEST(createFaces, correct_number_of_faces_in_vertex_to_faces)
     auto &vertexToFaces = lattice.getVertexToFaces();
 
     // Order is ascending y, then x, then z
-    vint vertexList = {0, 16, 24, 21, 29, 18, 26, 23, 31, 36, 44, 33, 41, 38, 46, 35, 43, 48, 56, 53, 61, 50, 58, 55, 63};
-    vint faceNumberList = {0, 1, 3, 8, 3, 3, 8, 3, 1, 4, 1, 4, 12, 12, 4, 1, 4, 1, 3, 8, 3, 3, 8, 3, 1};
+    vint vertexList = {8, 12, 10, 14, 9, 13, 11, 15, 18, 22, 16, 20, 19, 23, 17, 21, 24, 28, 26, 30, 25, 29, 27, 31};
+    vint faceNumberList = {1, 3, 8, 3, 3, 8, 3, 1, 4, 1, 4, 12, 12, 4, 1, 4, 1, 3, 8, 3, 3, 8, 3, 1};
 
     for (int i = 0; i < vertexList.size(); ++i)
     {
@@ -215,7 +217,7 @@ TEST(findFace, finds_valid_faces)
     RhombicLattice lattice = RhombicLattice(l);
     lattice.createFaces();
 
-    vvint testVertices = {{41, 56, 100, 104}, {50, 55, 98, 114}, {46, 58, 105, 106}, {29, 41, 88, 89}, {26, 29, 73, 89}, {21, 36, 80, 84}};
+    vvint testVertices = {{20, 28, 68, 72}, {25, 27, 66, 82}, {23, 29, 73, 74}, {14, 20, 56, 57}, {13, 14, 41, 57}, {10, 18, 48, 52}};
     vint expectedFaceIndices = {45, 37, 34, 26, 14, 3};
     for (int i = 0; i < expectedFaceIndices.size(); ++i)
     {
@@ -230,8 +232,8 @@ TEST(createUpEdgesMap, correct_number_of_up_edges_all_vertex_types)
     lattice.createUpEdgesMap();
     auto upEdgesMap = lattice.getUpEdgesMap();
     std::vector<std::string> directionList = {"xyz", "yz", "xz", "xy", "-xyz", "-yz", "-xz", "-xy"};
-    vint testVertices = {16, 24, 18, 26, 90, 42, 127, 91, 87, 110, 109, 117, 118};
-    vvint expectedUpEdgeNumbers = {{2, 1, 1, 2, 0, 1, 1, 0}, {3, 1, 3, 3, 1, 3, 1, 1}, {3, 3, 1, 3, 1, 1, 3, 1}, {4, 4, 4, 4, 4, 4, 4, 4}, {3, 0, 0, 0, 0, 3, 3, 3}, {0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 1, 1}, {0, 2, 1, 1, 2, 0, 0, 0}, {1, 0, 0, 0, 0, 1, 2, 2}, {1, 0, 0, 0, 0, 2, 1, 2}, {0, 1, 2, 1, 2, 0, 0, 0}, {1, 0, 0, 0, 0, 2, 2, 1}, {0, 1, 1, 2, 2, 0, 0, 0}};
+    vint testVertices = {8, 12, 9, 13, 58, 95, 59, 55, 78, 77, 85, 86};
+    vvint expectedUpEdgeNumbers = {{2, 1, 1, 2, 0, 1, 1, 0}, {3, 1, 3, 3, 1, 3, 1, 1}, {3, 3, 1, 3, 1, 1, 3, 1}, {4, 4, 4, 4, 4, 4, 4, 4}, {3, 0, 0, 0, 0, 3, 3, 3}, {0, 0, 0, 0, 0, 1, 1, 1}, {0, 2, 1, 1, 2, 0, 0, 0}, {1, 0, 0, 0, 0, 1, 2, 2}, {1, 0, 0, 0, 0, 2, 1, 2}, {0, 1, 2, 1, 2, 0, 0, 0}, {1, 0, 0, 0, 0, 2, 2, 1}, {0, 1, 1, 2, 2, 0, 0, 0}};
     int j = 0;
     for (const auto &direction : directionList)
     {
@@ -261,45 +263,42 @@ TEST(createVertexToEdges, correct_number_of_edges)
     RhombicLattice lattice = RhombicLattice(l);
     lattice.createVertexToEdges();
     vvint vertexToEdges = lattice.getVertexToEdges();
-    for (int vertexIndex = 0; vertexIndex < 2 * l * l * l; ++vertexIndex)
+    for (int vertexIndex = 0; vertexIndex < lattice.getNumberOfVertices(); ++vertexIndex)
     {
         cartesian4 coordinate = lattice.indexToCoordinate(vertexIndex);
         if (coordinate.w == 0)
         {
-            if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 1)
+            if (coordinate.x == 0 && coordinate.y == 0 && coordinate.z == 0)
             {
-                if (coordinate.x == 0 && coordinate.y == 0 && coordinate.z == 0)
-                {
-                    EXPECT_EQ(vertexToEdges[vertexIndex].size(), 1);
-                }
-                else if (coordinate.x != 0 && coordinate.y == 0 && coordinate.z == 0)
-                {
-                    EXPECT_EQ(vertexToEdges[vertexIndex].size(), 2);
-                }
-                else if (coordinate.x == 0 && coordinate.y != 0 && coordinate.z == 0)
-                {
-                    EXPECT_EQ(vertexToEdges[vertexIndex].size(), 2);
-                }
-                else if (coordinate.x == 0 && coordinate.y == 0 && coordinate.z != 0)
-                {
-                    EXPECT_EQ(vertexToEdges[vertexIndex].size(), 2);
-                }
-                else if (coordinate.x == 0 && coordinate.y != 0 && coordinate.z != 0)
-                {
-                    EXPECT_EQ(vertexToEdges[vertexIndex].size(), 4);
-                }
-                else if (coordinate.x != 0 && coordinate.y == 0 && coordinate.z != 0)
-                {
-                    EXPECT_EQ(vertexToEdges[vertexIndex].size(), 4);
-                }
-                else if (coordinate.x != 0 && coordinate.y != 0 && coordinate.z == 0)
-                {
-                    EXPECT_EQ(vertexToEdges[vertexIndex].size(), 4);
-                }
-                else
-                {
-                    EXPECT_EQ(vertexToEdges[vertexIndex].size(), 8);
-                }
+                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 1);
+            }
+            else if (coordinate.x != 0 && coordinate.y == 0 && coordinate.z == 0)
+            {
+                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 2);
+            }
+            else if (coordinate.x == 0 && coordinate.y != 0 && coordinate.z == 0)
+            {
+                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 2);
+            }
+            else if (coordinate.x == 0 && coordinate.y == 0 && coordinate.z != 0)
+            {
+                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 2);
+            }
+            else if (coordinate.x == 0 && coordinate.y != 0 && coordinate.z != 0)
+            {
+                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 4);
+            }
+            else if (coordinate.x != 0 && coordinate.y == 0 && coordinate.z != 0)
+            {
+                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 4);
+            }
+            else if (coordinate.x != 0 && coordinate.y != 0 && coordinate.z == 0)
+            {
+                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 4);
+            }
+            else
+            {
+                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 8);
             }
         }
         else
@@ -375,3 +374,31 @@ TEST(createVertexToEdges, correct_number_of_edges)
         }
     }
 }
+
+TEST(findNeighbour, matches_neighbour_and_edge_index)
+{
+    int l = 6;
+    RhombicLattice lattice = RhombicLattice(l);
+    std::vector<Direction> directions = {Direction::xyz, Direction::xy, Direction::xz, Direction::yz};
+    for (int vertexIndex = 0; vertexIndex < lattice.getNumberOfVertices(); ++vertexIndex)
+    {
+        for (const auto direction : directions)
+        {
+            for (const int sign : {1, -1})
+            {
+                int neighbourIndex = lattice.findNeighbour(vertexIndex, {direction, sign});
+                int edge = lattice.findEdge(vertexIndex, {direction, sign});
+                if (neighbourIndex == -1)
+                {
+                    EXPECT_THROW(lattice.neighbour(vertexIndex, direction, sign), std::invalid_argument);
+                    EXPECT_EQ(edge, -1);
+                }
+                else
+                {
+                    EXPECT_EQ(neighbourIndex, lattice.neighbour(vertexIndex, direction, sign));
+                    EXPECT_EQ(edge, lattice.edgeIndex(vertexIndex, direction, sign));
+                }
+            }
+        }
+    }
+}
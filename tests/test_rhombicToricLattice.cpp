@@ -37,14 +37,14 @@ TEST(neighbour, handles_valid_input)
     RhombicToricLattice lattice = RhombicToricLattice(l);
     int vertexIndex = 0;
     int sign = 1;
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", sign), 112);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", sign), 67);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", sign), 76);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", -sign), 79);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", -sign), 124);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", -sign), 115);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", sign), 64);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", -sign), 127);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", sign), 80);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", sign), 35);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", sign), 44);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", -sign), 47);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", -sign), 92);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", -sign), 83);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", sign), 32);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", -sign), 95);
     // EXPECT_EQ(latticeBCC.neighbour(vertexIndex, "x", sign), 1);
     // EXPECT_EQ(latticeBCC.neighbour(vertexIndex, "y", sign), 4);
     // EXPECT_EQ(latticeBCC.neighbour(vertexIndex, "z", sign), 16);
@@ -52,14 +52,14 @@ TEST(neighbour, handles_valid_input)
     // EXPECT_EQ(latticeBCC.neighbour(vertexIndex, "y", -sign), 12);
     // EXPECT_EQ(latticeBCC.neighbour(vertexIndex, "z", -sign), 48);
 
-    vertexIndex = 64;
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", sign), 5);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", sign), 20);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", sign), 17);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", -sign), 16);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", -sign), 1);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", -sign), 4);
-    EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", sign), 21);
+    vertexIndex = 32;
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xy", sign), 2);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "yz", sign), 10);
+    EXPECT_EQ(lattice.neighbour(vertexIndex, "xz", sign), 8);
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "xy", -sign), std::invalid_argument);
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "yz", -sign), std::invalid_argument);
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "xz", -sign), std::invalid_argument);
+    EXPECT_THROW(lattice.neighbour(vertexIndex, "xyz", sign), std::invalid_argument);
     EXPECT_EQ(lattice.neighbour(vertexIndex, "xyz", -sign), 0);
     // EXPECT_EQ(latticeBCC.neighbour(vertexIndex, "x", sign), 65);
     // EXPECT_EQ(latticeBCC.neighbour(vertexIndex, "y", sign), 68);
@@ -101,7 +101,7 @@ TEST(edgeIndex, excepts_invalid_signs)
 {
     int l = 4;
     RhombicToricLattice lattice = RhombicToricLattice(l);
-    int vertexIndex = 56;
+    int vertexIndex = 28;
     std::string direction = "yz";
     EXPECT_THROW(lattice.edgeIndex(vertexIndex, direction, 0), std::invalid_argument);
     EXPECT_THROW(lattice.edgeIndex(vertexIndex, direction, -0), std::invalid_argument);
@@ -115,19 +115,19 @@ TEST(edgeIndex, handles_valid_input)
     RhombicToricLattice lattice = RhombicToricLattice(l);
     int vertexIndex = 3;
     int sign = 1;
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xy", sign), 23);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xz", sign), 27);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "yz", sign), 25);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xyz", sign), 21);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xy", sign), 25);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xz", sign), 26);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "yz", sign), 27);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xyz", sign), 24);
     // EXPECT_EQ(latticeBCC.edgeIndex(vertexIndex, "x", sign), 22);
     // EXPECT_EQ(latticeBCC.edgeIndex(vertexIndex, "y", sign), 24);
     // EXPECT_EQ(latticeBCC.edgeIndex(vertexIndex, "z", sign), 26);
 
     vertexIndex = 7;
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xy", -sign), 1514);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xz", -sign), 2820);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "yz", -sign), 2783);
-    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xyz", -sign), 2772);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xy", -sign), 61);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xz", -sign), 62);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "yz", -sign), 63);
+    EXPECT_EQ(lattice.edgeIndex(vertexIndex, "xyz", -sign), 60);
     // EXPECT_EQ(latticeBCC.edgeIndex(vertexIndex, "x", -sign), 43);
     // EXPECT_EQ(latticeBCC.edgeIndex(vertexIndex, "y", -sign), 10);
     // EXPECT_EQ(latticeBCC.edgeIndex(vertexIndex, "z", -sign), 1314);
@@ -141,44 +141,44 @@ TEST(createFaces, handles_valid_input)
     vvint faceToVertices = lattice.getFaceToVertices();
     vvint faceToEdges = lattice.getFaceToEdges();
 
-    vint vertices = {0, 42, 216, 221};
+    vint vertices = {0, 21, 108, 113};
     EXPECT_EQ(faceToVertices[0], vertices);
-    vint edges = {0, 4, 1516, 1547};
+    vint edges = {0, 3, 172, 175};
     EXPECT_EQ(faceToEdges[0], edges);
 
-    vertices = {0, 37, 216, 246};
+    vertices = {0, 18, 108, 138};
     EXPECT_EQ(faceToVertices[1], vertices);
-    edges = {0, 6, 1518, 1722};
+    edges = {0, 2, 148, 150};
     EXPECT_EQ(faceToEdges[1], edges);
 
-    vertices = {0, 7, 216, 396};
+    vertices = {0, 3, 108, 288};
     EXPECT_EQ(faceToVertices[2], vertices);
-    edges = {0, 2, 1514, 2772};
+    edges = {0, 1, 28, 29};
     EXPECT_EQ(faceToEdges[2], edges);
 
-    vertices = {0, 186, 396, 401};
+    vertices = {0, 93, 288, 293};
     EXPECT_EQ(faceToVertices[3], vertices);
-    edges = {2, 1308, 2809, 2813};
+    edges = {1, 6, 746, 749};
     EXPECT_EQ(faceToEdges[3], edges);
 
-    vertices = {0, 181, 396, 426};
+    vertices = {0, 90, 288, 318};
     EXPECT_EQ(faceToVertices[4], vertices);
-    edges = {2, 1271, 2984, 2986};
+    edges = {1, 7, 723, 725};
     EXPECT_EQ(faceToEdges[4], edges);
 
-    vertices = {0, 31, 246, 426};
+    vertices = {0, 15, 138, 318};
     EXPECT_EQ(faceToVertices[5], vertices);
-    edges = {6, 221, 2986, 2988};
+    edges = {2, 7, 123, 126};
     EXPECT_EQ(faceToEdges[5], edges);
 
-    vertices = {167, 168, 347, 383};
+    vertices = {83, 84, 239, 275};
     EXPECT_EQ(faceToVertices[500], vertices);
-    edges = {1169, 1171, 2429, 2683};
+    edges = {664, 665, 676, 677};
     EXPECT_EQ(faceToEdges[500], edges);
 
-    vertices = {137, 167, 346, 347};
+    vertices = {68, 83, 238, 239};
     EXPECT_EQ(faceToVertices[501], vertices);
-    edges = {965, 1171, 2424, 2428};
+    edges = {546, 549, 665, 670};
     EXPECT_EQ(faceToEdges[501], edges);
 
     vint faceIndices = {0, 1, 2, 3, 4, 5, 35, 104, 124, 201, 553, 630};
@@ -192,7 +192,7 @@ TEST(createFaces, handles_valid_input)
 
     faceIndices = {240, 259, 350, 366, 367, 368, 369, 370, 371, 389, 459, 478};
     i = 0;
-    for (const auto &face : vertexToFaces[123])
+    for (const auto &face : vertexToFaces[61])
     {
         EXPECT_EQ(face.faceIndex, faceIndices[i]);
         ++i;
@@ -200,7 +200,7 @@ TEST(createFaces, handles_valid_input)
 
     faceIndices = {0, 1, 2, 111, 130, 131};
     i = 0;
-    for (const auto &face : vertexToFaces[216])
+    for (const auto &face : vertexToFaces[108])
     {
         EXPECT_EQ(face.faceIndex, faceIndices[i]);
         ++i;
@@ -208,7 +208,7 @@ TEST(createFaces, handles_valid_input)
 
     faceIndices = {132, 145, 149, 236, 237, 238};
     i = 0;
-    for (const auto &face : vertexToFaces[259])
+    for (const auto &face : vertexToFaces[151])
     {
         EXPECT_EQ(face.faceIndex, faceIndices[i]);
         ++i;
@@ -232,7 +232,7 @@ TEST(createFaces, correct_max_edge_index)
                     maxEdgeIndex = edgeIndex;
             }
         }
-        EXPECT_EQ(maxEdgeIndex, 7 * (2 * l * l * l - 1));
+        EXPECT_EQ(maxEdgeIndex, 4 * l * l * l - 1);
     }
 }
 
@@ -253,7 +253,7 @@ TEST(createFaces, correct_max_vertex_index)
                     maxVertexIndex = vertexIndex;
             }
         }
-        EXPECT_EQ(maxVertexIndex, (2 * l * l * l - 1));
+        EXPECT_EQ(maxVertexIndex, (3 * l * l * l / 2 - 1));
     }
 }
 
@@ -292,7 +292,7 @@ TEST(createFaces, vertices_in_correct_number_of_faces)
         RhombicToricLattice lattice = RhombicToricLattice(l);
         lattice.createFaces();
         auto vertexToFaces = lattice.getVertexToFaces();
-        for (int i = 0; i < 2 * l * l * l; ++i)
+        for (int i = 0; i < lattice.getNumberOfVertices(); ++i)
         {
             auto faces = vertexToFaces[i];
             cartesian4 coordinate = lattice.indexToCoordinate(i);
@@ -300,13 +300,9 @@ TEST(createFaces, vertices_in_correct_number_of_faces)
             {
                 EXPECT_EQ(faces.size(), 6);
             }
-            else if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
-            {
-                EXPECT_EQ(faces.size(), 12);
-            }
             else
             {
-                EXPECT_EQ(faces.size(), 0);
+                EXPECT_EQ(faces.size(), 12);
             }
         }
     }
@@ -324,19 +320,12 @@ TEST(createUpEdgesMap, vertices_have_correct_number_of_up_edges)
         for (const auto &direction : directionList)
         {
             vvint vertexToUpEdges = upEdgesMap[direction];
-            for (int i = 0; i < 2 * l * l * l; ++i)
+            for (int i = 0; i < lattice.getNumberOfVertices(); ++i)
             {
                 cartesian4 coordinate = lattice.indexToCoordinate(i);
                 if (coordinate.w == 0)
                 {
-                    if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
-                    {
-                        EXPECT_EQ(vertexToUpEdges[i].size(), 4);
-                    }
-                    else
-                    {
-                        EXPECT_EQ(vertexToUpEdges[i].size(), 0);
-                    }
+                    EXPECT_EQ(vertexToUpEdges[i].size(), 4);
                 }
                 else
                 {
@@ -355,19 +344,12 @@ TEST(createUpEdgesMap, vertices_have_correct_number_of_up_edges)
         for (const auto &direction : directionList)
         {
             vvint vertexToUpEdges = upEdgesMap["xy"];
-            for (int i = 0; i < 2 * l * l * l; ++i)
+            for (int i = 0; i < lattice.getNumberOfVertices(); ++i)
             {
                 cartesian4 coordinate = lattice.indexToCoordinate(i);
                 if (coordinate.w == 0)
                 {
-                    if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
-                    {
-                        EXPECT_EQ(vertexToUpEdges[i].size(), 4);
-                    }
-                    else
-                    {
-                        EXPECT_EQ(vertexToUpEdges[i].size(), 0);
-                    }
+                    EXPECT_EQ(vertexToUpEdges[i].size(), 4);
                 }
                 else
                 {
@@ -395,14 +377,14 @@ TEST(createUpEdgesMap, correct_edges_created)
     vvint vertexToUpEdges = upEdgesMap["-xy"];
     vint upEdges = vertexToUpEdges[0];
     std::sort(upEdges.begin(), upEdges.end());
-    vint expectedEdges = {4, 6, 555, 889};
+    vint expectedEdges = {2, 3, 4, 5};
     for (int i = 0; i < 4; ++i)
     {
         EXPECT_EQ(upEdges[i], expectedEdges[i]);
     }
-    upEdges = vertexToUpEdges[64];
+    upEdges = vertexToUpEdges[32];
     std::sort(upEdges.begin(), upEdges.end());
-    expectedEdges = {0, 452, 454};
+    expectedEdges = {0, 70, 87};
     for (int i = 0; i < 4; ++i)
     {
         EXPECT_EQ(upEdges[i], expectedEdges[i]);
@@ -411,14 +393,14 @@ TEST(createUpEdgesMap, correct_edges_created)
     vertexToUpEdges = upEdgesMap["yz"];
     upEdges = vertexToUpEdges[0];
     std::sort(upEdges.begin(), upEdges.end());
-    expectedEdges = {0, 4, 555, 811};
+    expectedEdges = {0, 3, 5, 6};
     for (int i = 0; i < 4; ++i)
     {
         EXPECT_EQ(upEdges[i], expectedEdges[i]);
     }
-    upEdges = vertexToUpEdges[65];
+    upEdges = vertexToUpEdges[33];
     std::sort(upEdges.begin(), upEdges.end());
-    expectedEdges = {41, 121, 455};
+    expectedEdges = {18, 65, 92};
     for (int i = 0; i < 4; ++i)
     {
         EXPECT_EQ(upEdges[i], expectedEdges[i]);
@@ -441,10 +423,10 @@ TEST(findFace, correct_faces_found)
     int l = 8;
     RhombicToricLattice lattice = RhombicToricLattice(l);
     lattice.createFaces();
-    vint expectedVertices = {0, 504, 1016, 1023};
+    vint expectedVertices = {0, 252, 760, 767};
     EXPECT_EQ(lattice.findFace(expectedVertices), 1512);
 
-    expectedVertices = {0, 9, 512, 960};
+    expectedVertices = {0, 4, 256, 704};
     EXPECT_EQ(lattice.findFace(expectedVertices), 2);
 }
 
@@ -453,9 +435,9 @@ TEST(createVertexToEdges, correct_edges_created)
     int l = 6;
     RhombicToricLattice lattice = RhombicToricLattice(l);
     lattice.createVertexToEdges();
-    vint expectedEdges = {14, 16, 18, 20, 1731, 2785, 2989, 3000};
+    vint expectedEdges = {8, 9, 10, 11, 12, 13, 14, 15};
     vvint vertexToEdges = lattice.getVertexToEdges();
-    vint edges = vertexToEdges[2];
+    vint edges = vertexToEdges[1];
     EXPECT_EQ(edges.size(), expectedEdges.size());
     std::sort(edges.begin(), edges.end());
     for (int i = 0; i < edges.size(); ++i)
@@ -463,8 +445,8 @@ TEST(createVertexToEdges, correct_edges_created)
         EXPECT_EQ(edges[i], expectedEdges[i]);
     }
 
-    expectedEdges = {0, 1514, 1516, 1518};
-    edges = vertexToEdges[216];
+    expectedEdges = {0, 29, 150, 175};
+    edges = vertexToEdges[108];
     EXPECT_EQ(edges.size(), expectedEdges.size());
     std::sort(edges.begin(), edges.end());
     for (int i = 0; i < edges.size(); ++i)
@@ -472,8 +454,8 @@ TEST(createVertexToEdges, correct_edges_created)
         EXPECT_EQ(edges[i], expectedEdges[i]);
     }
 
-    expectedEdges = {18, 55, 261, 1519};
-    edges = vertexToEdges[217];
+    expectedEdges = {11, 26, 145, 180};
+    edges = vertexToEdges[109];
     EXPECT_EQ(edges.size(), expectedEdges.size());
     std::sort(edges.begin(), edges.end());
     for (int i = 0; i < edges.size(); ++i)
@@ -488,19 +470,53 @@ TEST(createVertexToEdges, correct_number_of_edges_each_vertex)
     RhombicToricLattice lattice = RhombicToricLattice(l);
     lattice.createVertexToEdges();
     vvint vertexToEdges = lattice.getVertexToEdges();
-    for (int vertexIndex = 0; vertexIndex < 2 * l * l * l; ++vertexIndex)
+    for (int vertexIndex = 0; vertexIndex < lattice.getNumberOfVertices(); ++vertexIndex)
     {
         cartesian4 coordinate = lattice.indexToCoordinate(vertexIndex);
         if (coordinate.w == 0)
         {
-            if ((coordinate.x + coordinate.y + coordinate.z) % 2 == 0)
-            {
-                EXPECT_EQ(vertexToEdges[vertexIndex].size(), 8);
-            }
+            EXPECT_EQ(vertexToEdges[vertexIndex].size(), 8);
         }
         else
         {
             EXPECT_EQ(vertexToEdges[vertexIndex].size(), 4);
         }
     }
-}
\ No newline at end of file
+}
+
+TEST(lookupFace, finds_every_face)
+{
+    int l = 6;
+    RhombicToricLattice lattice = RhombicToricLattice(l);
+    lattice.createFaces();
+    auto &faceToVertices = lattice.getFaceToVertices();
+    for (int faceIndex = 0; faceIndex < faceToVertices.size(); ++faceIndex)
+    {
+        auto vertices = faceToVertices[faceIndex];
+        EXPECT_EQ(lattice.lookupFace({vertices[3], vertices[1], vertices[0], vertices[2]}), faceIndex);
+    }
+    // Vertices taken from two different faces
+    auto face0 = faceToVertices[0];
+    auto face1 = faceToVertices[lattice.getVertexToFaces()[face0[0]][1].faceIndex];
+    EXPECT_EQ(lattice.lookupFace({face0[0], face0[1], face1[2], face1[3]}), -1);
+}
+
+
+TEST(edgeOwners, every_edge_is_owned_by_one_end)
+{
+    int l = 6;
+    RhombicToricLattice lattice = RhombicToricLattice(l);
+    lattice.createVertexToEdges();
+    EXPECT_EQ(lattice.getNumberOfEdges(), 4 * l * l * l);
+    auto &vertexToEdges = lattice.getVertexToEdges();
+    for (int vertexIndex = 0; vertexIndex < lattice.getNumberOfVertices(); ++vertexIndex)
+    {
+        for (const int edgeIndex : vertexToEdges[vertexIndex])
+        {
+            auto &owner = lattice.getEdgeOwner(edgeIndex);
+            EXPECT_LT(owner.vertex, lattice.getNumberOfW0Vertices());
+            EXPECT_EQ(lattice.findEdge(owner.vertex, owner.direction), edgeIndex);
+            EXPECT_EQ(lattice.findEdge(vertexIndex, lattice.edgeDirection(edgeIndex, vertexIndex)), edgeIndex);
+        }
+    }
+}